@@ -9,17 +9,24 @@
 #include <exception>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "limb_arithmetic.h"
 #include "stl_helper_functions.hpp"
 
 #define BIG_INTEGER_NO_THROW
 
+#ifndef BIG_INTEGER_RADIX_CONVERSION_THRESHOLD
+#define BIG_INTEGER_RADIX_CONVERSION_THRESHOLD 32
+#endif
+
 namespace org {
     namespace atib {
         namespace numerics {
@@ -48,17 +55,20 @@ namespace org {
             };
 
             class big_integer final {
-                std::vector<int> decimal_digits_;
-                std::vector<bool> binary_digits_;
-                std::string hexadecimal_number_str_;
-                std::string decimal_number_str_;
-                std::string octal_number_str_;
-                std::string binary_number_str_;
-                size_t first_{};
-                size_t last_{};
+            public:
+                using limb_type = detail::limb_type;
+
+            private:
+                std::vector<limb_type> limbs_;
                 number_base base_;
                 bool is_negative_number_{};
                 bool is_nan_{};
+                mutable std::shared_ptr<const std::vector<int>> decimal_digits_;
+                mutable std::shared_ptr<const std::vector<bool>> binary_digits_;
+                mutable std::shared_ptr<const std::string> hexadecimal_number_str_;
+                mutable std::shared_ptr<const std::string> decimal_number_str_;
+                mutable std::shared_ptr<const std::string> octal_number_str_;
+                mutable std::shared_ptr<const std::string> binary_number_str_;
 
             public:
                 static constexpr const char *NaN{"NaN"};
@@ -97,11 +107,13 @@ namespace org {
 
                 explicit big_integer(std::vector<bool>);
 
-                big_integer(const big_integer &) = default;
+                static big_integer from_limbs(std::vector<limb_type> limbs, const bool is_negative_number = false);
+
+                big_integer(const big_integer &);
 
                 big_integer(big_integer &&) noexcept = default;
 
-                big_integer &operator=(const big_integer &) = default;
+                big_integer &operator=(const big_integer &);
 
                 big_integer &operator=(big_integer &&) = default;
 
@@ -180,12 +192,20 @@ namespace org {
 
                 big_integer multiply_two_big_integers(const big_integer &rhs) const;
 
+                big_integer square() const;
+
+                big_integer pow(const std::uint64_t exponent) const;
+
+                void divide_two_big_integers(const big_integer &rhs, big_integer &quotient, big_integer &remainder) const;
+
                 void invert_sign();
 
                 const std::vector<int> &get_decimal_digits() const;
 
                 const std::vector<bool> &get_binary_digits() const;
 
+                const std::vector<limb_type> &get_limbs() const noexcept;
+
                 std::string get_hexadecimal_number(const std::string &prefix = "0x",
                                                    const std::string &postfix = "",
                                                    const size_t number_of_digits = 0) const;
@@ -217,7 +237,18 @@ namespace org {
             private:
                 template<typename IntegralType>
                 big_integer(const IntegralType number, std::true_type)
-                        : big_integer{std::to_string(number)} {}
+                        : base_{number_base::decimal} {
+                    if constexpr (std::is_signed_v<IntegralType>) {
+                        is_negative_number_ = number < 0;
+                    }
+
+                    const auto magnitude{
+                            is_negative_number_ ? 0U - static_cast<limb_type>(number) : static_cast<limb_type>(number)
+                    };
+
+                    if (magnitude != 0U)
+                        limbs_.emplace_back(magnitude);
+                }
 
                 template<typename FloatingPointType>
                 big_integer(const FloatingPointType number, std::false_type) {
@@ -229,7 +260,19 @@ namespace org {
                     assign(value);
                 }
 
-                void update_big_integer_string_representations();
+                void clear_cached_string_representations() noexcept;
+
+                template<typename RepresentationType, typename FactoryType>
+                static const RepresentationType &get_or_create_cached_representation(
+                        std::shared_ptr<const RepresentationType> &cached_representation,
+                        FactoryType create_representation);
+
+                const std::string &get_cached_decimal_number() const;
+
+                const std::string &get_cached_number_in_power_of_two_base(
+                        std::shared_ptr<const std::string> &cached_number_str,
+                        const char *prefix,
+                        const size_t bits_per_digit) const;
 
                 void set_big_integer_to_default_zero_value();
 
@@ -250,19 +293,36 @@ namespace org {
 
                 inline byte get_correct_digit_value(const char ch) const noexcept;
 
-                void find_2s_complement_for_binary_number();
+                void convert_digit_characters_to_limbs(const std::string &digits);
+
+                static constexpr const size_t decimal_digits_per_limb{19U};
+
+                static constexpr const limb_type ten_to_the_power_of_19{10000000000000000000ULL};
 
-                void convert_number_to_decimal_and_store();
+                static const std::vector<limb_type> &get_cached_power_of_ten(const size_t power_index);
 
-                void get_binary_digits_for_decimal_number();
+                static std::vector<limb_type> get_power_of_ten(const std::uint64_t exponent);
 
-                void get_octal_digits_for_decimal_number();
+                static std::vector<limb_type> convert_decimal_digits_to_limbs(const char *digits, const size_t digit_count);
 
-                void get_hexadecimal_digits_for_decimal_number();
+                static std::vector<limb_type> convert_decimal_digits_to_limbs_schoolbook(const char *digits,
+                                                                                       const size_t digit_count);
 
-                static std::string div_by_two(const std::string &number_str);
+                static std::vector<limb_type> convert_power_of_two_base_digits_to_limbs(const std::string &digits,
+                                                                                        const size_t bits_per_digit);
 
-                static byte odds_to_one(const char ch);
+                static std::string convert_limbs_to_decimal_digits(const std::vector<limb_type> &limbs);
+
+                static void append_decimal_digits(std::string &digits,
+                                                  const std::vector<limb_type> &limbs,
+                                                  const size_t minimum_digit_count);
+
+                static void append_decimal_digits_schoolbook(std::string &digits,
+                                                             const std::vector<limb_type> &limbs,
+                                                             const size_t minimum_digit_count);
+
+                static std::string convert_limbs_to_power_of_two_base_digits(const std::vector<limb_type> &limbs,
+                                                                             const size_t bits_per_digit);
 
                 template<typename NumberType,
                         typename = std::enable_if_t<
@@ -300,6 +360,18 @@ namespace org {
 
             big_integer operator^(const big_integer &, const big_integer &);
 
+            // Quotient truncated towards zero and remainder with the sign of the dividend, computed by one division.
+            std::pair<big_integer, big_integer> divmod(const big_integer &dividend, const big_integer &divisor);
+
+            void divmod(const big_integer &dividend,
+                        const big_integer &divisor,
+                        big_integer &quotient,
+                        big_integer &remainder);
+
+            // base^exponent by repeated squaring, 0^0 being 1. Powers of two are shifts and powers of ten come from
+            // cached powers.
+            big_integer pow(const big_integer &base, const std::uint64_t exponent);
+
             void swap(big_integer &lhs, big_integer &rhs) noexcept;
 
             std::ostream &operator<<(std::ostream &, const big_integer &);
@@ -0,0 +1,44 @@
+#ifndef BIGINTEGER_V1_COMBINATORICS_H
+#define BIGINTEGER_V1_COMBINATORICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "big_integer.h"
+
+namespace org {
+    namespace atib {
+        namespace numerics {
+
+            // n! = (n / 2)!^2 * swing(n) by Luschny's prime swing: the odd part of swing(n) = n! / (n / 2)!^2 comes
+            // from its prime factorization, the power of two is a final shift. Many small factors are always
+            // multiplied in a balanced tree, so that the large multiplications get operands of similar size.
+            big_integer factorial(const std::uint64_t n);
+
+            // n! / (k! * (n - k)!), 0 for k > n. Computed from the exponents of the primes up to n (Legendre), or
+            // as the product of n - k + 1, ..., n divided by k! when k is small compared to n.
+            big_integer binomial(const std::uint64_t n, const std::uint64_t k);
+
+            // n * (n - 2) * (n - 4) * ... down to 1 or 2, 1 for n < 2
+            big_integer double_factorial(const std::uint64_t n);
+
+            // the product of the primes up to n, 1 for n < 2
+            big_integer primorial(const std::uint64_t n);
+
+            // The product of numbers by a balanced tree: both halves are multiplied recursively before their products,
+            // so that the operands of every multiplication have about the same size instead of a growing accumulator
+            // meeting one small factor at a time. 1 for no numbers, NaN if one is NaN. Independent subtrees are
+            // multiplied on up to thread_count threads (one per hardware thread for 0).
+            big_integer product(const std::vector<big_integer> &numbers, const size_t thread_count = 1U);
+
+            template<typename Iterator>
+            big_integer product(Iterator first, Iterator last, const size_t thread_count = 1U) {
+                return product(std::vector<big_integer>(first, last), thread_count);
+            }
+
+        }// namespace numerics
+    }// namespace atib
+}// namespace org
+
+#endif// BIGINTEGER_V1_COMBINATORICS_H
@@ -0,0 +1,277 @@
+#ifndef BIGINTEGER_V1_LIMB_ARITHMETIC_H
+#define BIGINTEGER_V1_LIMB_ARITHMETIC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Operand sizes (in limbs) of the smaller factor from which Karatsuba, Toom-3, Toom-4 and NTT multiplication is used,
+// squaring switches from schoolbook to Karatsuba later as the schoolbook square computes every cross product once.
+// The defaults were measured on x86-64 and can be overridden at compile time.
+#ifndef BIG_INTEGER_KARATSUBA_THRESHOLD
+#define BIG_INTEGER_KARATSUBA_THRESHOLD 32
+#endif
+
+#ifndef BIG_INTEGER_KARATSUBA_SQUARE_THRESHOLD
+#define BIG_INTEGER_KARATSUBA_SQUARE_THRESHOLD 48
+#endif
+
+#ifndef BIG_INTEGER_TOOM3_THRESHOLD
+#define BIG_INTEGER_TOOM3_THRESHOLD 400
+#endif
+
+#ifndef BIG_INTEGER_TOOM4_THRESHOLD
+#define BIG_INTEGER_TOOM4_THRESHOLD 768
+#endif
+
+#ifndef BIG_INTEGER_NTT_THRESHOLD
+#define BIG_INTEGER_NTT_THRESHOLD 49152
+#endif
+
+// Divisor and quotient size (in limbs) from which Burnikel-Ziegler division replaces Knuth's algorithm D.
+#ifndef BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD
+#define BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD 96
+#endif
+
+namespace org {
+    namespace atib {
+        namespace numerics {
+            namespace detail {
+
+                // Magnitudes are stored as little-endian sequences of 64-bit limbs without leading zero limbs,
+                // the value zero being represented by an empty sequence.
+                using limb_type = std::uint64_t;
+                using limb_vector = std::vector<limb_type>;
+
+                static constexpr const size_t limb_bits{64U};
+                static constexpr const limb_type max_limb_value{~limb_type{}};
+
+#if defined(__SIZEOF_INT128__)
+                __extension__ typedef unsigned __int128 double_limb_type;
+#endif
+
+                inline limb_type multiply_two_limbs(const limb_type lhs, const limb_type rhs, limb_type &high) noexcept {
+#if defined(__SIZEOF_INT128__)
+                    const double_limb_type product{static_cast<double_limb_type>(lhs) * rhs};
+                    high = static_cast<limb_type>(product >> 64U);
+                    return static_cast<limb_type>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+                    return _umul128(lhs, rhs, &high);
+#else
+                    const limb_type lhs_low{lhs & 0xFFFFFFFFULL}, lhs_high{lhs >> 32U};
+                    const limb_type rhs_low{rhs & 0xFFFFFFFFULL}, rhs_high{rhs >> 32U};
+                    const limb_type low_low{lhs_low * rhs_low};
+                    const limb_type low_high{lhs_low * rhs_high};
+                    const limb_type high_low{lhs_high * rhs_low};
+                    const limb_type middle{(low_low >> 32U) + (low_high & 0xFFFFFFFFULL) + (high_low & 0xFFFFFFFFULL)};
+                    high = lhs_high * rhs_high + (low_high >> 32U) + (high_low >> 32U) + (middle >> 32U);
+                    return (middle << 32U) | (low_low & 0xFFFFFFFFULL);
+#endif
+                }
+
+                // Divides the double limb (high, low) by divisor, high must be less than divisor.
+                inline limb_type divide_double_limb(const limb_type high,
+                                                    const limb_type low,
+                                                    const limb_type divisor,
+                                                    limb_type &remainder) noexcept {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+                    limb_type quotient;
+                    __asm__("divq %4"
+                            : "=a"(quotient), "=d"(remainder)
+                            : "a"(low), "d"(high), "rm"(divisor)
+                            : "cc");
+                    return quotient;
+#elif defined(__SIZEOF_INT128__)
+                    const double_limb_type dividend{(static_cast<double_limb_type>(high) << 64U) | low};
+                    remainder = static_cast<limb_type>(dividend % divisor);
+                    return static_cast<limb_type>(dividend / divisor);
+#elif defined(_MSC_VER) && _MSC_VER >= 1920 && defined(_M_X64)
+                    return _udiv128(high, low, divisor, &remainder);
+#else
+                    limb_type quotient{}, current_remainder{high};
+                    for (size_t i{limb_bits}; i > 0U; --i) {
+                        const bool overflow{(current_remainder >> 63U) != 0U};
+                        current_remainder = (current_remainder << 1U) | ((low >> (i - 1)) & 1U);
+                        quotient <<= 1U;
+                        if (overflow || current_remainder >= divisor) {
+                            current_remainder -= divisor;
+                            quotient |= 1U;
+                        }
+                    }
+                    remainder = current_remainder;
+                    return quotient;
+#endif
+                }
+
+                // lhs * rhs mod modulus for a non-zero modulus
+                inline limb_type multiply_modulo_limb(const limb_type lhs,
+                                                      const limb_type rhs,
+                                                      const limb_type modulus) noexcept {
+                    limb_type high, remainder;
+                    const limb_type low{multiply_two_limbs(lhs, rhs, high)};
+                    divide_double_limb(high % modulus, low, modulus, remainder);
+                    return remainder;
+                }
+
+                inline size_t count_leading_zero_bits(const limb_type limb) noexcept {
+                    if (0U == limb)
+                        return limb_bits;
+#if defined(__GNUC__) || defined(__clang__)
+                    return static_cast<size_t>(__builtin_clzll(limb));
+#else
+                    size_t count{};
+                    for (limb_type mask{1ULL << 63U}; (limb & mask) == 0U; mask >>= 1U)
+                        ++count;
+                    return count;
+#endif
+                }
+
+                inline size_t count_trailing_zero_bits(const limb_type limb) noexcept {
+                    if (0U == limb)
+                        return limb_bits;
+#if defined(__GNUC__) || defined(__clang__)
+                    return static_cast<size_t>(__builtin_ctzll(limb));
+#else
+                    size_t count{};
+                    for (limb_type mask{1U}; (limb & mask) == 0U; mask <<= 1U)
+                        ++count;
+                    return count;
+#endif
+                }
+
+                inline size_t get_normalized_size(const limb_type *limbs, size_t size) noexcept {
+                    while (size > 0U && 0U == limbs[size - 1])
+                        --size;
+                    return size;
+                }
+
+                inline void trim_leading_zero_limbs(limb_vector &limbs) {
+                    limbs.resize(get_normalized_size(limbs.data(), limbs.size()));
+                }
+
+                int compare_limb_sequences(const limb_type *lhs, const limb_type *rhs, size_t size) noexcept;
+
+                limb_type add_limb_sequences(limb_type *result,
+                                             const limb_type *lhs,
+                                             size_t lhs_size,
+                                             const limb_type *rhs,
+                                             size_t rhs_size) noexcept;
+
+                limb_type subtract_limb_sequences(limb_type *result,
+                                                  const limb_type *lhs,
+                                                  size_t lhs_size,
+                                                  const limb_type *rhs,
+                                                  size_t rhs_size) noexcept;
+
+                limb_type multiply_limb_sequence_by_limb(limb_type *result,
+                                                         const limb_type *limbs,
+                                                         size_t size,
+                                                         limb_type multiplier) noexcept;
+
+                limb_type multiply_add_limb_sequence_by_limb(limb_type *result,
+                                                             const limb_type *limbs,
+                                                             size_t size,
+                                                             limb_type multiplier) noexcept;
+
+                limb_type multiply_subtract_limb_sequence_by_limb(limb_type *result,
+                                                                  const limb_type *limbs,
+                                                                  size_t size,
+                                                                  limb_type multiplier) noexcept;
+
+                void multiply_limb_sequences_schoolbook(limb_type *result,
+                                                        const limb_type *lhs,
+                                                        size_t lhs_size,
+                                                        const limb_type *rhs,
+                                                        size_t rhs_size) noexcept;
+
+                // Multiplies two limb sequences choosing the algorithm from their sizes, result must hold
+                // lhs_size + rhs_size limbs and must not overlap any of the operands. Identical operands are
+                // squared with the dedicated squaring algorithms.
+                void multiply_limb_sequences(limb_type *result,
+                                             const limb_type *lhs,
+                                             size_t lhs_size,
+                                             const limb_type *rhs,
+                                             size_t rhs_size);
+
+                // result must hold 2 * size limbs and must not overlap limbs.
+                void square_limb_sequence(limb_type *result, const limb_type *limbs, size_t size);
+
+                void square_limb_sequence_schoolbook(limb_type *result, const limb_type *limbs, size_t size) noexcept;
+
+                void multiply_limb_sequences_karatsuba(limb_type *result,
+                                                       const limb_type *lhs,
+                                                       size_t lhs_size,
+                                                       const limb_type *rhs,
+                                                       size_t rhs_size);
+
+                void multiply_limb_sequences_toom3(limb_type *result,
+                                                   const limb_type *lhs,
+                                                   size_t lhs_size,
+                                                   const limb_type *rhs,
+                                                   size_t rhs_size);
+
+                void multiply_limb_sequences_toom4(limb_type *result,
+                                                   const limb_type *lhs,
+                                                   size_t lhs_size,
+                                                   const limb_type *rhs,
+                                                   size_t rhs_size);
+
+                // Number-theoretic transform modulo three primes combined with the Chinese remainder theorem.
+                void multiply_limb_sequences_ntt(limb_type *result,
+                                                 const limb_type *lhs,
+                                                 size_t lhs_size,
+                                                 const limb_type *rhs,
+                                                 size_t rhs_size);
+
+                int compare_magnitudes(const limb_vector &lhs, const limb_vector &rhs) noexcept;
+
+                limb_vector add_magnitudes(const limb_vector &lhs, const limb_vector &rhs);
+
+                limb_vector subtract_magnitudes(const limb_vector &lhs, const limb_vector &rhs);
+
+                limb_vector multiply_magnitudes(const limb_vector &lhs, const limb_vector &rhs);
+
+                limb_vector square_magnitude(const limb_vector &limbs);
+
+                limb_type divide_magnitude_by_limb(limb_vector &limbs, limb_type divisor) noexcept;
+
+                // limbs mod divisor without computing the quotient
+                limb_type get_magnitude_remainder(const limb_vector &limbs, limb_type divisor) noexcept;
+
+                // base^exponent mod modulus for a non-zero modulus
+                limb_type raise_modulo_limb(limb_type base, std::uint64_t exponent, limb_type modulus) noexcept;
+
+                // Divides choosing the algorithm from the operand sizes, divisor must not be zero.
+                void divide_magnitudes(const limb_vector &dividend,
+                                       const limb_vector &divisor,
+                                       limb_vector &quotient,
+                                       limb_vector &remainder);
+
+                // Knuth's algorithm D, divisor must not be zero.
+                void divide_magnitudes_knuth(const limb_vector &dividend,
+                                             const limb_vector &divisor,
+                                             limb_vector &quotient,
+                                             limb_vector &remainder);
+
+                // Burnikel-Ziegler recursive division, divisor must not be zero.
+                void divide_magnitudes_burnikel_ziegler(const limb_vector &dividend,
+                                                        const limb_vector &divisor,
+                                                        limb_vector &quotient,
+                                                        limb_vector &remainder);
+
+                limb_vector shift_magnitude_left(const limb_vector &limbs, size_t bit_count);
+
+                limb_vector shift_magnitude_right(const limb_vector &limbs, size_t bit_count);
+
+                size_t get_bit_length(const limb_vector &limbs) noexcept;
+
+            }// namespace detail
+        }// namespace numerics
+    }// namespace atib
+}// namespace org
+
+#endif// BIGINTEGER_V1_LIMB_ARITHMETIC_H
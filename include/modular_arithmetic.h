@@ -0,0 +1,152 @@
+#ifndef BIGINTEGER_V1_MODULAR_ARITHMETIC_H
+#define BIGINTEGER_V1_MODULAR_ARITHMETIC_H
+
+#include <vector>
+
+#include "big_integer.h"
+
+// Modulus size (in limbs) from which Montgomery reduction multiplies by -m^-1 mod R instead of clearing one limb at a
+// time.
+#ifndef BIG_INTEGER_MONTGOMERY_REDC_THRESHOLD
+#define BIG_INTEGER_MONTGOMERY_REDC_THRESHOLD 128
+#endif
+
+namespace org {
+    namespace atib {
+        namespace numerics {
+
+            // Barrett reduction by a fixed modulus, results are in [0, |modulus|). A zero or NaN modulus makes every
+            // result NaN.
+            class barrett_context final {
+            public:
+                using limb_type = big_integer::limb_type;
+
+                explicit barrett_context(const big_integer &modulus);
+
+                const big_integer &get_modulus() const noexcept;
+
+                big_integer reduce(const big_integer &number) const;
+
+                big_integer mul_mod(const big_integer &lhs, const big_integer &rhs) const;
+
+                big_integer add_mod(const big_integer &lhs, const big_integer &rhs) const;
+
+                // base^exponent mod |modulus| by sliding-window exponentiation, NaN for negative exponents
+                big_integer pow(const big_integer &base, const big_integer &exponent) const;
+
+            private:
+                big_integer modulus_;
+                // floor(B^(2 * n) / |modulus|) for the limb base B and the modulus' limb count n
+                std::vector<limb_type> inverse_;
+
+                big_integer make_result(std::vector<limb_type> magnitude, const bool is_negative_number) const;
+
+                void reduce_magnitude(std::vector<limb_type> &magnitude) const;
+
+                void reduce_short_magnitude(std::vector<limb_type> &magnitude) const;
+            };
+
+            // Montgomery multiplication by a fixed odd modulus m with R = B^n for the limb base B and the modulus' limb
+            // count n. mul() and square() take and return numbers in Montgomery form x * R mod m, operands outside
+            // [0, m) are reduced first. An even, zero or NaN modulus makes every result NaN.
+            class montgomery_context final {
+            public:
+                using limb_type = big_integer::limb_type;
+
+                explicit montgomery_context(const big_integer &modulus);
+
+                const big_integer &get_modulus() const noexcept;
+
+                big_integer to_montgomery(const big_integer &number) const;
+
+                big_integer from_montgomery(const big_integer &number) const;
+
+                // lhs * rhs * R^-1 mod m
+                big_integer mul(const big_integer &lhs, const big_integer &rhs) const;
+
+                // number^2 * R^-1 mod m
+                big_integer square(const big_integer &number) const;
+
+                // base^exponent mod m in normal form by sliding-window exponentiation, NaN for negative exponents
+                big_integer pow(const big_integer &base, const big_integer &exponent) const;
+
+                // pow() for secret exponents by fixed windows, the sequence of operations and memory accesses only
+                // depends on the lengths of the exponent and the modulus
+                big_integer pow_constant_time(const big_integer &base, const big_integer &exponent) const;
+
+            private:
+                big_integer modulus_;
+                // -m^-1 mod B, and -m^-1 mod R for moduli long enough to be reduced by multiplications
+                limb_type negated_inverse_{};
+                std::vector<limb_type> negated_inverse_limbs_;
+                // R^2 mod m, padded to n limbs like every Montgomery form operand
+                std::vector<limb_type> r_squared_;
+
+                std::vector<limb_type> get_reduced_limbs(const big_integer &number) const;
+
+                std::vector<limb_type> get_montgomery_form_limbs(const big_integer &number) const;
+
+                // result = lhs * rhs * R^-1 mod m for n-limb operands, result must hold n limbs and may overlap them.
+                void multiply_limbs(limb_type *result, const limb_type *lhs, const limb_type *rhs) const;
+
+                // multiply_limbs() by interleaved product and reduction rows, taking the same time for all operands.
+                void multiply_limbs_interleaved(limb_type *result, const limb_type *lhs, const limb_type *rhs) const;
+
+                void square_limbs(limb_type *result, const limb_type *limbs) const;
+
+                // result = product * R^-1 mod m for a 2n-limb product, which is overwritten.
+                void reduce_limbs(limb_type *result, limb_type *product) const;
+            };
+
+            // Chinese remaindering for a fixed set of pairwise coprime moduli. The moduli are combined pairwise in a
+            // product tree whose nodes keep the inverse of the left product modulo the right one, so that a
+            // reconstruction costs one modular and one plain multiplication per node. Moduli that are zero, NaN or
+            // not pairwise coprime make every result NaN.
+            class crt_context final {
+            public:
+                explicit crt_context(const std::vector<big_integer> &moduli);
+
+                // the product of the moduli' magnitudes
+                const big_integer &get_modulus() const noexcept;
+
+                // The x in [0, get_modulus()) with x = residues[i] mod moduli[i], NaN for a residue count different
+                // from the modulus count and NaN residues.
+                big_integer reconstruct(const std::vector<big_integer> &residues) const;
+
+            private:
+                // combines a residue modulo the left product with one modulo the right product
+                struct combination {
+                    barrett_context right_modulus;
+                    big_integer left_inverse;
+                };
+
+                big_integer modulus_;
+                // products_[0] holds |moduli|, every further level the products of pairs of the previous one, an odd
+                // one out is carried up unchanged
+                std::vector<std::vector<big_integer>> products_;
+                // combinations_[k][i] combines products_[k][2 * i] and products_[k][2 * i + 1]
+                std::vector<std::vector<combination>> combinations_;
+            };
+
+            // number^-1 mod |modulus| in [0, |modulus|), NaN if number and modulus are not coprime, for a zero modulus
+            // and NaN operands.
+            big_integer inverse_mod(const big_integer &number, const big_integer &modulus);
+
+            // crt_context{moduli}.reconstruct(residues), for a single reconstruction
+            big_integer crt(const std::vector<big_integer> &residues, const std::vector<big_integer> &moduli);
+
+            // base^exponent mod |modulus| in [0, |modulus|), computed in Montgomery form for odd moduli and with
+            // Barrett reduction otherwise. Negative exponents, a zero modulus and NaN operands give NaN.
+            big_integer pow_mod(const big_integer &base, const big_integer &exponent, const big_integer &modulus);
+
+            // pow_mod() for secret exponents, see montgomery_context::pow_constant_time(). Only odd moduli are
+            // supported, others give NaN.
+            big_integer pow_mod_constant_time(const big_integer &base,
+                                              const big_integer &exponent,
+                                              const big_integer &modulus);
+
+        }// namespace numerics
+    }// namespace atib
+}// namespace org
+
+#endif// BIGINTEGER_V1_MODULAR_ARITHMETIC_H
@@ -0,0 +1,54 @@
+#ifndef BIGINTEGER_V1_NUMBER_THEORY_H
+#define BIGINTEGER_V1_NUMBER_THEORY_H
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "big_integer.h"
+
+// Operand size (in limbs) from which gcd() and extended_gcd() reduce both numbers by a matrix computed recursively
+// from their top halves (half-GCD). Shorter operands are reduced by Lehmer steps on their leading bits, single limbs by
+// binary GCD.
+#ifndef BIG_INTEGER_HALF_GCD_THRESHOLD
+#define BIG_INTEGER_HALF_GCD_THRESHOLD 128
+#endif
+
+namespace org {
+    namespace atib {
+        namespace numerics {
+
+            // floor(sqrt(number)), NaN for negative numbers
+            big_integer isqrt(const big_integer &number);
+
+            // isqrt(number) and number - isqrt(number)^2
+            std::pair<big_integer, big_integer> isqrt_rem(const big_integer &number);
+
+            // The degree-th root truncated towards zero, NaN for a zero degree and for negative numbers with even
+            // degree.
+            big_integer iroot(const big_integer &number, const std::uint64_t degree);
+
+            // Whether number is the square of an integer. Most non-squares are rejected by residue tables modulo 64,
+            // 63, 65 and 11 without computing a root.
+            bool is_perfect_square(const big_integer &number);
+
+            // Whether number is a^b for integers a and b > 1, 0 and +-1 included. Every prime exponent up to the bit
+            // length is tried after residue filters, only odd ones for negative numbers.
+            bool is_perfect_power(const big_integer &number);
+
+            // The non-negative greatest common divisor, gcd(0, 0) = 0. NaN if either number is NaN.
+            big_integer gcd(const big_integer &lhs, const big_integer &rhs);
+
+            // The non-negative least common multiple, 0 if either number is 0.
+            big_integer lcm(const big_integer &lhs, const big_integer &rhs);
+
+            // gcd(lhs, rhs) with Bezout coefficients s and t such that lhs * s + rhs * t = gcd(lhs, rhs). They are
+            // the cofactors of the Euclidean remainder sequence, |s| <= |rhs| / gcd and |t| <= |lhs| / gcd.
+            std::tuple<big_integer, big_integer, big_integer> extended_gcd(const big_integer &lhs,
+                                                                           const big_integer &rhs);
+
+        }// namespace numerics
+    }// namespace atib
+}// namespace org
+
+#endif// BIGINTEGER_V1_NUMBER_THEORY_H
@@ -0,0 +1,50 @@
+#ifndef BIGINTEGER_V1_PRIMES_H
+#define BIGINTEGER_V1_PRIMES_H
+
+#include <cstddef>
+#include <random>
+
+#include "big_integer.h"
+
+// next_prime() and prev_prime() sieve windows of BIG_INTEGER_PRIME_SIEVE_WINDOW_FACTOR odd candidates per bit of the
+// start, by BIG_INTEGER_PRIME_SIEVE_PRIME_FACTOR odd primes per bit (at most the 6541 odd primes below 2^16).
+#ifndef BIG_INTEGER_PRIME_SIEVE_WINDOW_FACTOR
+#define BIG_INTEGER_PRIME_SIEVE_WINDOW_FACTOR 16
+#endif
+
+#ifndef BIG_INTEGER_PRIME_SIEVE_PRIME_FACTOR
+#define BIG_INTEGER_PRIME_SIEVE_PRIME_FACTOR 16
+#endif
+
+namespace org {
+    namespace atib {
+        namespace numerics {
+
+            // Whether number is prime after trial division by the primes below 1000. Numbers below 2^64 are decided
+            // exactly by strong Miller-Rabin tests to seven fixed bases, larger ones by the Baillie-PSW test (a strong
+            // Miller-Rabin test to base 2 and a strong Lucas test with Selfridge's parameters, no composite passing
+            // both is known) followed by rounds Miller-Rabin tests to bases drawn from a generator seeded by number,
+            // so that results are reproducible. Negative numbers and NaN are not prime.
+            bool is_probable_prime(const big_integer &number, const size_t rounds = 0U);
+
+            // The smallest prime greater than number, 2 below 2 and NaN for NaN. Odd candidates are sieved by small
+            // primes in windows whose residues are carried over from window to window, and only the survivors get
+            // is_probable_prime()'s tests. Multi-limb candidates are split among thread_count worker threads (one
+            // per hardware thread for 0) that search interleaved windows with their own sieve and stop as soon as an
+            // earlier window holds a prime, so the result is the same for every thread count.
+            big_integer next_prime(const big_integer &number, const size_t thread_count = 1U);
+
+            // The largest prime less than number, searched like next_prime(). NaN for numbers up to 2 and NaN.
+            big_integer prev_prime(const big_integer &number, const size_t thread_count = 1U);
+
+            // A probable prime of exactly bit_count bits, the first one from a random number drawn from generator
+            // on, searched like next_prime(). NaN for bit counts below 2.
+            big_integer random_prime(const size_t bit_count,
+                                     std::mt19937_64 &generator,
+                                     const size_t thread_count = 1U);
+
+        }// namespace numerics
+    }// namespace atib
+}// namespace org
+
+#endif// BIGINTEGER_V1_PRIMES_H
@@ -0,0 +1,66 @@
+#ifndef BIGINTEGER_V1_RECIPROCAL_H
+#define BIGINTEGER_V1_RECIPROCAL_H
+
+#include <vector>
+
+#include "big_integer.h"
+
+// Divisors of at least BIG_INTEGER_RECIPROCAL_THRESHOLD limbs get a precomputed inverse, shorter ones are divided
+// faster by long division. The inverse is computed by Newton iteration doubling its precision from
+// BIG_INTEGER_RECIPROCAL_NEWTON_THRESHOLD limbs on.
+#ifndef BIG_INTEGER_RECIPROCAL_THRESHOLD
+#define BIG_INTEGER_RECIPROCAL_THRESHOLD 256
+#endif
+
+#ifndef BIG_INTEGER_RECIPROCAL_NEWTON_THRESHOLD
+#define BIG_INTEGER_RECIPROCAL_NEWTON_THRESHOLD 16
+#endif
+
+namespace org {
+    namespace atib {
+        namespace numerics {
+
+            // Precomputed inverse of a divisor, dividing by it costs two multiplications instead of a long division.
+            class reciprocal final {
+            public:
+                using limb_type = big_integer::limb_type;
+
+                explicit reciprocal(const big_integer &divisor);
+
+                const big_integer &get_divisor() const noexcept;
+
+                // Quotient truncated towards zero and remainder with the sign of the dividend, like divmod.
+                void divmod(const big_integer &dividend, big_integer &quotient, big_integer &remainder) const;
+
+                big_integer divide(const big_integer &dividend) const;
+
+                big_integer remainder(const big_integer &dividend) const;
+
+            private:
+                big_integer divisor_;
+                // |divisor| shifted left until its most significant bit is set, the Newton iteration converges from
+                // the top limbs only for normalized divisors
+                std::vector<limb_type> normalized_divisor_;
+                size_t normalization_shift_{};
+                // floor(B^(2 * n) / normalized divisor) for the limb base B and the divisor's limb count n, empty for
+                // short divisors
+                std::vector<limb_type> inverse_;
+
+                void divide_magnitude(const std::vector<limb_type> &dividend,
+                                      std::vector<limb_type> &quotient,
+                                      std::vector<limb_type> &remainder) const;
+
+                void divide_block(std::vector<limb_type> &block, std::vector<limb_type> &quotient) const;
+
+                static big_integer compute_inverse(const std::vector<limb_type> &divisor, const size_t size);
+            };
+
+            big_integer operator/(const big_integer &, const reciprocal &);
+
+            big_integer operator%(const big_integer &, const reciprocal &);
+
+        }// namespace numerics
+    }// namespace atib
+}// namespace org
+
+#endif// BIGINTEGER_V1_RECIPROCAL_H
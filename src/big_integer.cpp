@@ -1,6 +1,7 @@
 #include "../include/big_integer.h"
 
 #include <deque>
+#include <mutex>
 
 using namespace org::atib::numerics;
 
@@ -38,6 +39,23 @@ const big_integer big_integer::zero{};
 const big_integer big_integer::plus_one{"1"};
 const big_integer big_integer::minus_one{"-1"};
 
+template<typename RepresentationType, typename FactoryType>
+const RepresentationType &big_integer::get_or_create_cached_representation(
+        std::shared_ptr<const RepresentationType> &cached_representation,
+        FactoryType create_representation) {
+    std::shared_ptr<const RepresentationType> representation{std::atomic_load(&cached_representation)};
+
+    if (!representation) {
+        std::shared_ptr<const RepresentationType> expected{};
+        representation = std::make_shared<const RepresentationType>(create_representation());
+
+        if (!std::atomic_compare_exchange_strong(&cached_representation, &expected, representation))
+            representation = std::move(expected);
+    }
+
+    return *representation;
+}
+
 big_integer org::atib::numerics::operator+(const big_integer &lhs,
                                            const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan()) {
@@ -61,6 +79,8 @@ big_integer org::atib::numerics::operator-(const big_integer &lhs,
 big_integer org::atib::numerics::operator*(const big_integer &lhs,
                                            const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan()) {
+        if (&lhs == &rhs)
+            return lhs.square();
         return lhs.multiply_two_big_integers(rhs);
     }
     return big_integer::nan;
@@ -68,106 +88,60 @@ big_integer org::atib::numerics::operator*(const big_integer &lhs,
 
 big_integer org::atib::numerics::operator/(const big_integer &lhs,
                                            const big_integer &rhs) {
-    if (!lhs.is_nan() && !rhs.is_nan()) {
-#ifndef BIG_INTEGER_NO_THROW
-        if (rhs.is_zero()) {
-          if (lhs.is_zero())
-            throw zero_divided_by_zero_error{};
-          throw division_by_zero_error{};
-        }
-#else
-        if (lhs.is_zero() || rhs.is_zero())
-            return rhs.is_zero() ? big_integer::nan : big_integer::zero;
-#endif
-
-        const bool is_division_negative{
-                (!lhs.is_negative_number() && rhs.is_negative_number()) ||
-                (lhs.is_negative_number() && !rhs.is_negative_number())
-        };
-
-        big_integer dividend{lhs.is_negative_number() ? lhs.abs() : lhs};
-        big_integer divisor{rhs.is_negative_number() ? rhs.abs() : rhs};
-
-        if (dividend < divisor)
-            return big_integer::zero;
-
-        if (rhs.is_positive_one())
-            return big_integer{lhs.get_decimal_digits()};
-
-        if (rhs.is_negative_one()) {
-            big_integer result{lhs.get_decimal_digits()};
-            result.invert_sign();
-            return result;
-        }
-
-        big_integer result{};
-        while (dividend >= divisor) {
-            size_t shift_count{};
-
-            do {
-                ++shift_count;
-            } while (dividend >= (divisor << shift_count));
-
-            --shift_count;
-            big_integer big_one{big_integer::plus_one};
-            result += (big_one << shift_count);
-            dividend -= (divisor << shift_count);
-        }
-
-        if (!is_division_negative)
-            return result;
-
-        result.invert_sign();
-        return result;
-    }
-
-    return big_integer::nan;
+    big_integer quotient{}, remainder{};
+    divmod(lhs, rhs, quotient, remainder);
+    return quotient;
 }
 
 big_integer org::atib::numerics::operator%(const big_integer &lhs,
                                            const big_integer &rhs) {
-    if (!lhs.is_nan() && !rhs.is_nan()) {
+    big_integer quotient{}, remainder{};
+    divmod(lhs, rhs, quotient, remainder);
+    return remainder;
+}
+
+std::pair<big_integer, big_integer> org::atib::numerics::divmod(const big_integer &dividend,
+                                                                const big_integer &divisor) {
+    std::pair<big_integer, big_integer> result{};
+    divmod(dividend, divisor, result.first, result.second);
+    return result;
+}
+
+void org::atib::numerics::divmod(const big_integer &dividend,
+                                 const big_integer &divisor,
+                                 big_integer &quotient,
+                                 big_integer &remainder) {
+    if (!dividend.is_nan() && !divisor.is_nan()) {
 #ifndef BIG_INTEGER_NO_THROW
-        if (rhs.is_zero()) {
-          if (lhs.is_zero())
+        if (divisor.is_zero()) {
+          if (dividend.is_zero())
             throw zero_divided_by_zero_error{};
           throw division_by_zero_error{};
         }
 #else
-        if (lhs.is_zero() || rhs.is_zero())
-            return rhs.is_zero() ? big_integer::nan : big_integer::zero;
-#endif
-
-        big_integer dividend{lhs.is_negative_number() ? lhs.abs() : lhs};
-        const big_integer divisor{rhs.is_negative_number() ? rhs.abs() : rhs};
-
-        if (dividend < divisor)
-            return lhs;
-
-        if (rhs.is_positive_one() || rhs.is_negative_one())
-            return big_integer::zero;
-
-        while (dividend >= divisor) {
-            size_t shift_count{};
-
-            do {
-                ++shift_count;
-            } while (dividend >= (divisor << shift_count));
-
-            --shift_count;
-            dividend -= (divisor << shift_count);
+        if (dividend.is_zero() || divisor.is_zero()) {
+            quotient = divisor.is_zero() ? big_integer::nan : big_integer::zero;
+            remainder = quotient;
+            return;
         }
+#endif
 
-        return lhs.is_negative_number() ? -dividend : dividend;
+        dividend.divide_two_big_integers(divisor, quotient, remainder);
+        return;
     }
 
-    return big_integer::nan;
+    quotient = big_integer::nan;
+    remainder = big_integer::nan;
+}
+
+big_integer org::atib::numerics::pow(const big_integer &base, const std::uint64_t exponent) {
+    return base.pow(exponent);
 }
 
 bool org::atib::numerics::operator==(const big_integer &lhs,
                                      const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan())
-        return lhs.get_decimal_digits() == rhs.get_decimal_digits();
+        return lhs.is_negative_number() == rhs.is_negative_number() && lhs.get_limbs() == rhs.get_limbs();
     return lhs.is_nan() && rhs.is_nan();
 }
 
@@ -179,30 +153,15 @@ bool org::atib::numerics::operator!=(const big_integer &lhs,
 bool org::atib::numerics::operator<(const big_integer &lhs,
                                     const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan()) {
-        const size_t lhs_size{lhs.get_decimal_digits().size()};
-        const size_t rhs_size{rhs.get_decimal_digits().size()};
-
         if (lhs.is_negative_number() && !rhs.is_negative_number())
             return true;
 
         if (!lhs.is_negative_number() && rhs.is_negative_number())
             return false;
 
-        if (lhs_size != rhs_size) {
-            if (lhs_size < rhs_size)
-                return !lhs.is_negative_number() && !rhs.is_negative_number();
-
-            return lhs.is_negative_number() && rhs.is_negative_number();
-        } else {
-            const auto lhs_digits{lhs.get_decimal_digits()};
-            const auto rhs_digits{rhs.get_decimal_digits()};
-            for (size_t i{}; i < lhs_size; ++i) {
-                if (lhs_digits.at(i) < rhs_digits.at(i))
-                    return true;
-                if (lhs_digits.at(i) > rhs_digits.at(i))
-                    return false;
-            }
-        }
+        const int comparison_result{detail::compare_magnitudes(lhs.get_limbs(), rhs.get_limbs())};
+
+        return lhs.is_negative_number() ? comparison_result > 0 : comparison_result < 0;
     }
     return false;
 }
@@ -225,35 +184,20 @@ bool org::atib::numerics::operator>=(const big_integer &lhs,
 big_integer org::atib::numerics::operator|(const big_integer &lhs,
                                            const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan()) {
-        if (lhs.is_zero())
-            return rhs;
+        const std::vector<big_integer::limb_type> &lhs_limbs{lhs.get_limbs()};
+        const std::vector<big_integer::limb_type> &rhs_limbs{rhs.get_limbs()};
 
-        if (rhs.is_zero())
-            return lhs;
+        const bool is_lhs_longer{lhs_limbs.size() > rhs_limbs.size()};
 
-        const std::vector<bool> &lhs_binary_digits{lhs.get_binary_digits()};
-        const std::vector<bool> &rhs_binary_digits{rhs.get_binary_digits()};
+        const std::vector<big_integer::limb_type> &longer_number{is_lhs_longer ? lhs_limbs : rhs_limbs};
+        const std::vector<big_integer::limb_type> &shorter_number{!is_lhs_longer ? lhs_limbs : rhs_limbs};
 
-        const bool is_lhs_longer{lhs_binary_digits.size() > rhs_binary_digits.size()};
+        std::vector<big_integer::limb_type> result{longer_number};
 
-        const std::vector<bool> &longer_binary_number{
-                is_lhs_longer ? lhs_binary_digits : rhs_binary_digits
-        };
-
-        const std::vector<bool> &shorter_binary_number{
-                !is_lhs_longer ? lhs_binary_digits : rhs_binary_digits
-        };
-
-        std::vector<bool> result{longer_binary_number};
+        for (size_t i{}; i < shorter_number.size(); ++i)
+            result[i] |= shorter_number[i];
 
-        for (size_t i{shorter_binary_number.size()},
-                     j{longer_binary_number.size() - 1};
-             i > 0U;
-             --i, --j) {
-            result[j] = result[j] || shorter_binary_number[i - 1];
-        }
-
-        return big_integer{std::move(result)};
+        return big_integer::from_limbs(std::move(result));
     }
 
     return big_integer::nan;
@@ -262,32 +206,15 @@ big_integer org::atib::numerics::operator|(const big_integer &lhs,
 big_integer org::atib::numerics::operator&(const big_integer &lhs,
                                            const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan()) {
-        if (lhs.is_zero() || rhs.is_zero())
-            return big_integer::zero;
-
-        const std::vector<bool> &lhs_binary_digits{lhs.get_binary_digits()};
-        const std::vector<bool> &rhs_binary_digits{rhs.get_binary_digits()};
-
-        const bool is_lhs_longer{lhs_binary_digits.size() > rhs_binary_digits.size()};
+        const std::vector<big_integer::limb_type> &lhs_limbs{lhs.get_limbs()};
+        const std::vector<big_integer::limb_type> &rhs_limbs{rhs.get_limbs()};
 
-        const std::vector<bool> &longer_binary_number{
-                is_lhs_longer ? lhs_binary_digits : rhs_binary_digits
-        };
-
-        const std::vector<bool> &shorter_binary_number{
-                !is_lhs_longer ? lhs_binary_digits : rhs_binary_digits
-        };
-
-        std::vector<bool> result(shorter_binary_number.size(), false);
+        std::vector<big_integer::limb_type> result(std::min(lhs_limbs.size(), rhs_limbs.size()));
 
-        for (size_t i{shorter_binary_number.size()}, j{longer_binary_number.size()};
-             i > 0U;
-             --i, --j) {
-            result[i - 1] =
-                    shorter_binary_number[i - 1] && longer_binary_number[j - 1];
-        }
+        for (size_t i{}; i < result.size(); ++i)
+            result[i] = lhs_limbs[i] & rhs_limbs[i];
 
-        return big_integer{std::move(result)};
+        return big_integer::from_limbs(std::move(result));
     }
 
     return big_integer::nan;
@@ -296,29 +223,20 @@ big_integer org::atib::numerics::operator&(const big_integer &lhs,
 big_integer org::atib::numerics::operator^(const big_integer &lhs,
                                            const big_integer &rhs) {
     if (!lhs.is_nan() && !rhs.is_nan()) {
-        const std::vector<bool> &lhs_binary_digits{lhs.get_binary_digits()};
-        const std::vector<bool> &rhs_binary_digits{rhs.get_binary_digits()};
-
-        const bool is_lhs_longer{lhs_binary_digits.size() > rhs_binary_digits.size()};
+        const std::vector<big_integer::limb_type> &lhs_limbs{lhs.get_limbs()};
+        const std::vector<big_integer::limb_type> &rhs_limbs{rhs.get_limbs()};
 
-        const std::vector<bool> &longer_binary_number{
-                is_lhs_longer ? lhs_binary_digits : rhs_binary_digits
-        };
+        const bool is_lhs_longer{lhs_limbs.size() > rhs_limbs.size()};
 
-        const std::vector<bool> &shorter_binary_number{
-                !is_lhs_longer ? lhs_binary_digits : rhs_binary_digits
-        };
+        const std::vector<big_integer::limb_type> &longer_number{is_lhs_longer ? lhs_limbs : rhs_limbs};
+        const std::vector<big_integer::limb_type> &shorter_number{!is_lhs_longer ? lhs_limbs : rhs_limbs};
 
-        std::vector<bool> result{longer_binary_number};
+        std::vector<big_integer::limb_type> result{longer_number};
 
-        for (size_t i{shorter_binary_number.size()},
-                     j{longer_binary_number.size() - 1};
-             i > 0U;
-             --i, --j) {
-            result[j] = (result[j] && !shorter_binary_number[i - 1]) || (!result[j] && shorter_binary_number[i - 1]);
-        }
+        for (size_t i{}; i < shorter_number.size(); ++i)
+            result[i] ^= shorter_number[i];
 
-        return big_integer{std::move(result)};
+        return big_integer::from_limbs(std::move(result));
     }
 
     return big_integer::nan;
@@ -342,11 +260,49 @@ std::istream &org::atib::numerics::operator>>(std::istream &is,
 }
 
 const std::vector<int> &big_integer::get_decimal_digits() const {
-    return decimal_digits_;
+    return get_or_create_cached_representation(decimal_digits_, [this]() {
+        std::vector<int> decimal_digits{};
+
+        if (!is_nan_) {
+            const std::string &decimal_number_str{get_cached_decimal_number()};
+            decimal_digits.reserve(decimal_number_str.length());
+
+            for (size_t i{is_negative_number_ ? 1U : 0U}; i < decimal_number_str.length(); ++i) {
+                const int digit_value{decimal_number_str[i] - '0'};
+                decimal_digits.emplace_back(is_negative_number_ ? -digit_value : digit_value);
+            }
+        }
+
+        return decimal_digits;
+    });
 }
 
 const std::vector<bool> &big_integer::get_binary_digits() const {
-    return binary_digits_;
+    return get_or_create_cached_representation(binary_digits_, [this]() {
+        std::vector<bool> binary_digits{};
+
+        if (!is_nan_) {
+            const std::string binary_digits_str{convert_limbs_to_power_of_two_base_digits(limbs_, 1U)};
+            binary_digits.reserve(binary_digits_str.length());
+
+            for (const char binary_digit : binary_digits_str)
+                binary_digits.emplace_back('1' == binary_digit);
+        }
+
+        return binary_digits;
+    });
+}
+
+const std::vector<big_integer::limb_type> &big_integer::get_limbs() const noexcept {
+    return limbs_;
+}
+
+big_integer big_integer::from_limbs(std::vector<limb_type> limbs, const bool is_negative_number) {
+    big_integer result{};
+    detail::trim_leading_zero_limbs(limbs);
+    result.limbs_ = std::move(limbs);
+    result.is_negative_number_ = is_negative_number && !result.limbs_.empty();
+    return result;
 }
 
 std::string big_integer::get_decimal_number(
@@ -355,7 +311,7 @@ std::string big_integer::get_decimal_number(
         const size_t number_of_digits) const {
     const size_t prefix_len{prefix.length()};
     const size_t postfix_len{postfix.length()};
-    std::string decimal_number_str{this->decimal_number_str_};
+    std::string decimal_number_str{get_cached_decimal_number()};
     const size_t sign_offset{is_negative_number_ ? 1U : 0U};
 
     if (!prefix.empty() && !stl::helper::str_contains(decimal_number_str, prefix)) {
@@ -397,7 +353,7 @@ std::string big_integer::get_binary_number(
         const size_t number_of_digits) const {
     const size_t prefix_len{prefix.length()};
     const size_t postfix_len{postfix.length()};
-    std::string binary_number_str{this->binary_number_str_};
+    std::string binary_number_str{get_cached_number_in_power_of_two_base(binary_number_str_, "0b", 1U)};
     const size_t sign_offset{is_negative_number_ ? 1U : 0U};
 
     if (!prefix.empty() && !stl::helper::str_contains(binary_number_str, prefix)) {
@@ -435,26 +391,24 @@ bool big_integer::is_nan() const noexcept {
 }
 
 bool big_integer::is_zero() const noexcept {
-    return 1U == decimal_digits_.size() && 0 == decimal_digits_[0];
+    return !is_nan_ && limbs_.empty();
 }
 
 bool big_integer::is_positive_one() const noexcept {
-    return 1U == decimal_digits_.size() && 1 == decimal_digits_[0];
+    return !is_negative_number_ && 1U == limbs_.size() && 1U == limbs_[0];
 }
 
 bool big_integer::is_negative_one() const noexcept {
-    return 1U == decimal_digits_.size() && -1 == decimal_digits_[0];
+    return is_negative_number_ && 1U == limbs_.size() && 1U == limbs_[0];
 }
 
 big_integer big_integer::abs() const {
-    std::vector<int> decimal_digits{this->decimal_digits_};
-
-    if (this->is_negative_number_) {
-        for (auto &digit : decimal_digits)
-            digit = abs(digit);
-    }
+    if (!this->is_negative_number_)
+        return *this;
 
-    return big_integer{std::move(decimal_digits)};
+    big_integer result{*this};
+    result.invert_sign();
+    return result;
 }
 
 bool big_integer::is_negative_number() const {
@@ -462,19 +416,34 @@ bool big_integer::is_negative_number() const {
 }
 
 org::atib::numerics::big_integer::big_integer()
-        : decimal_digits_{0},
-          binary_digits_{false},
-          hexadecimal_number_str_{"0x0"},
-          decimal_number_str_{"0"},
-          octal_number_str_{"0o0"},
-          binary_number_str_{"0b0"},
-          first_{0},
-          last_{1},
+        : limbs_{},
           base_{number_base::decimal},
           is_negative_number_{},
           is_nan_{} {
 }
 
+big_integer::big_integer(const big_integer &rhs)
+        : limbs_{rhs.limbs_},
+          base_{rhs.base_},
+          is_negative_number_{rhs.is_negative_number_},
+          is_nan_{rhs.is_nan_},
+          decimal_digits_{std::atomic_load(&rhs.decimal_digits_)},
+          binary_digits_{std::atomic_load(&rhs.binary_digits_)},
+          hexadecimal_number_str_{std::atomic_load(&rhs.hexadecimal_number_str_)},
+          decimal_number_str_{std::atomic_load(&rhs.decimal_number_str_)},
+          octal_number_str_{std::atomic_load(&rhs.octal_number_str_)},
+          binary_number_str_{std::atomic_load(&rhs.binary_number_str_)} {
+}
+
+big_integer &big_integer::operator=(const big_integer &rhs) {
+    if (this != &rhs) {
+        big_integer temp{rhs};
+        this->swap(temp);
+    }
+
+    return *this;
+}
+
 big_integer::big_integer(std::vector<int> digits,
                          const number_base base /*= number_base::decimal*/)
         : base_{base} {
@@ -511,11 +480,6 @@ big_integer::big_integer(const std::string &number)
         set_big_integer_value_nan();
 #endif
     }
-
-    if (!is_zero() && !is_positive_one() && !is_negative_one() && !is_nan()) {
-        convert_number_to_decimal_and_store();
-        update_big_integer_string_representations();
-    }
 }
 
 std::string big_integer::get_big_integer(number_base base) const {
@@ -538,7 +502,7 @@ big_integer::operator std::string() const noexcept {
 }
 
 big_integer::operator const char *() const noexcept {
-    return this->decimal_number_str_.c_str();
+    return get_cached_decimal_number().c_str();
 }
 
 big_integer big_integer::operator-() const {
@@ -626,31 +590,22 @@ big_integer big_integer::operator--(int) {
 }
 
 big_integer big_integer::operator<<(const size_t count) const {
-    std::vector<bool> shifted_binary_digits{this->binary_digits_};
-    if (count != 0U)
-        shifted_binary_digits.insert(std::cend(shifted_binary_digits), count, false);
-    return big_integer{std::move(shifted_binary_digits)};
+    if (this->is_nan() || 0U == count)
+        return *this;
+
+    return from_limbs(detail::shift_magnitude_left(this->limbs_, count), this->is_negative_number_);
 }
 
 big_integer big_integer::operator>>(const size_t count) const {
-    if (count >= this->binary_digits_.size())
-        return big_integer::zero;
-
-    if (count != 0U) {
-        std::vector<bool> shifted_binary_digits{this->binary_digits_};
-        shifted_binary_digits.erase(std::cend(shifted_binary_digits) - count,
-                                    std::cend(shifted_binary_digits));
-        return big_integer{std::move(shifted_binary_digits)};
-    }
+    if (this->is_nan() || 0U == count)
+        return *this;
 
-    return big_integer{*this};
+    return from_limbs(detail::shift_magnitude_right(this->limbs_, count), this->is_negative_number_);
 }
 
 big_integer &big_integer::operator<<=(const size_t count) {
-    if (count != 0U) {
-        std::vector<bool> shifted_binary_digits{std::move(this->binary_digits_)};
-        shifted_binary_digits.insert(std::cend(shifted_binary_digits), count, false);
-        big_integer result{std::move(shifted_binary_digits)};
+    if (!this->is_nan() && count != 0U) {
+        big_integer result{from_limbs(detail::shift_magnitude_left(this->limbs_, count), this->is_negative_number_)};
         this->swap(result);
     }
 
@@ -658,15 +613,11 @@ big_integer &big_integer::operator<<=(const size_t count) {
 }
 
 big_integer &big_integer::operator>>=(const size_t count) {
-    if (count >= this->binary_digits_.size()) {
-        this->set_big_integer_to_default_zero_value();
-    } else if (count != 0U) {
-        std::vector<bool> shifted_binary_digits{std::move(this->binary_digits_)};
-        shifted_binary_digits.erase(std::cend(shifted_binary_digits) - count,
-                                    std::cend(shifted_binary_digits));
-        big_integer result{std::move(shifted_binary_digits)};
+    if (!this->is_nan() && count != 0U) {
+        big_integer result{from_limbs(detail::shift_magnitude_right(this->limbs_, count), this->is_negative_number_)};
         this->swap(result);
     }
+
     return *this;
 }
 
@@ -689,19 +640,24 @@ big_integer &big_integer::operator^=(const big_integer &rhs) {
 }
 
 int big_integer::operator[](const size_t index) const noexcept {
-    if (this->is_nan() || (index >= decimal_digits_.size()))
+    if (this->is_nan())
         return 0;
 
-    const size_t digits_count{decimal_digits_.size()};
+    const std::vector<int> &decimal_digits{get_decimal_digits()};
+    const size_t digits_count{decimal_digits.size()};
 
-    return decimal_digits_[digits_count - 1 - index];
+    if (index >= digits_count)
+        return 0;
+
+    return decimal_digits[digits_count - 1 - index];
 }
 
 int big_integer::at(const size_t index) const {
     if (this->is_nan())
         return 0;
 
-    const size_t digits_count{decimal_digits_.size()};
+    const std::vector<int> &decimal_digits{get_decimal_digits()};
+    const size_t digits_count{decimal_digits.size()};
 
     if (index >= digits_count) {
         std::ostringstream oss{};
@@ -709,7 +665,7 @@ int big_integer::at(const size_t index) const {
         throw std::out_of_range{oss.str()};
     }
 
-    return decimal_digits_.at(digits_count - 1 - index);
+    return decimal_digits.at(digits_count - 1 - index);
 }
 
 big_integer::operator bool() const {
@@ -717,6 +673,7 @@ big_integer::operator bool() const {
 }
 
 void big_integer::swap(big_integer &rhs) noexcept {
+    std::swap(this->limbs_, rhs.limbs_);
     std::swap(this->decimal_digits_, rhs.decimal_digits_);
     std::swap(this->binary_digits_, rhs.binary_digits_);
     std::swap(this->decimal_number_str_, rhs.decimal_number_str_);
@@ -725,8 +682,7 @@ void big_integer::swap(big_integer &rhs) noexcept {
     std::swap(this->hexadecimal_number_str_, rhs.hexadecimal_number_str_);
     std::swap(this->base_, rhs.base_);
     std::swap(this->is_negative_number_, rhs.is_negative_number_);
-    std::swap(this->first_, rhs.first_);
-    std::swap(this->last_, rhs.last_);
+    std::swap(this->is_nan_, rhs.is_nan_);
 }
 
 big_integer big_integer::add_two_big_integers_together(
@@ -740,197 +696,105 @@ big_integer big_integer::add_two_big_integers_together(
     if (rhs.is_zero())
         return *this;
 
-    std::deque<int> result{};
-
-    bool is_negative_addition{};
-
-    if ((this->is_negative_number() && !rhs.is_negative_number()) ||
-        (!this->is_negative_number() && rhs.is_negative_number())) {
-        auto abs_this{!this->is_negative_number() ? *this : this->abs()};
-        auto abs_rhs{!rhs.is_negative_number() ? rhs : rhs.abs()};
-
-        if (abs_this == abs_rhs)
-            return big_integer::zero;
+    if (this->is_negative_number_ == rhs.is_negative_number_)
+        return from_limbs(detail::add_magnitudes(limbs_, rhs.limbs_), is_negative_number_);
 
-        const bool is_abs_first_greater_abs_second{abs_this > abs_rhs};
-        const bool is_abs_second_greater_than_abs_first{
-                !is_abs_first_greater_abs_second
-        };
-
-        is_negative_addition =
-                (this->is_negative_number() && is_abs_first_greater_abs_second) ||
-                (rhs.is_negative_number() && is_abs_second_greater_than_abs_first);
-
-        const std::vector<int> &greater_number_decimal_digits{
-                is_abs_first_greater_abs_second ? abs_this.decimal_digits_
-                                                : abs_rhs.decimal_digits_
-        };
+    const int comparison_result{detail::compare_magnitudes(limbs_, rhs.limbs_)};
 
-        std::vector<int> &smaller_number_decimal_digits{
-                !is_abs_first_greater_abs_second ? abs_this.decimal_digits_
-                                                 : abs_rhs.decimal_digits_
-        };
-
-        for (auto &digit : smaller_number_decimal_digits)
-            digit = -digit;
-
-        size_t n{greater_number_decimal_digits.size()};
-        size_t m{smaller_number_decimal_digits.size()};
-        int carry{};
-
-        while (n > 0U || m > 0U || carry != 0) {
-            int sum{carry};
-            carry = 0;
-
-            if (n > 0U) {
-                const size_t index{n - 1};
-                if (sum + greater_number_decimal_digits[index] < 0) {
-                    sum += 10 + greater_number_decimal_digits[index];
-                    --carry;
-                } else {
-                    sum += greater_number_decimal_digits[index];
-                }
-                --n;
-            }
-            if (m > 0U) {
-                const size_t index{m - 1};
-                if (sum + smaller_number_decimal_digits[index] < 0) {
-                    sum += 10 + smaller_number_decimal_digits[index];
-                    --carry;
-                } else {
-                    sum += smaller_number_decimal_digits[index];
-                }
-                --m;
-            }
-
-            if (0 == carry)
-                carry = sum / 10;
+    if (0 == comparison_result)
+        return big_integer::zero;
 
-            const byte remainder{static_cast<byte>(std::abs(sum) % 10)};
-            result.emplace_front(remainder);
-        }
+    if (comparison_result > 0)
+        return from_limbs(detail::subtract_magnitudes(limbs_, rhs.limbs_), is_negative_number_);
 
-    } else {
-        const std::vector<int> &lhs_digits{this->decimal_digits_};
-        const std::vector<int> &rhs_digits{rhs.decimal_digits_};
+    return from_limbs(detail::subtract_magnitudes(rhs.limbs_, limbs_), rhs.is_negative_number_);
+}
 
-        size_t n{lhs_digits.size()};
-        size_t m{rhs_digits.size()};
-        int carry{};
+big_integer big_integer::multiply_two_big_integers(
+        const big_integer &rhs) const {
+    if (this->is_nan() || rhs.is_nan())
+        return big_integer::nan;
 
-        while (n > 0U || m > 0U || carry != 0) {
-            int sum{carry};
+    if (this == &rhs)
+        return square();
 
-            if (n > 0U) {
-                sum += lhs_digits[n - 1];
-                --n;
-            }
-            if (m > 0U) {
-                sum += rhs_digits[m - 1];
-                --m;
-            }
+    if (this->is_zero() || rhs.is_zero())
+        return zero;
 
-            carry = sum / 10;
+    const bool is_negative_product{is_negative_number_ != rhs.is_negative_number_};
 
-            const byte remainder{static_cast<byte>(std::abs(sum) % 10)};
+    return from_limbs(detail::multiply_magnitudes(limbs_, rhs.limbs_), is_negative_product);
+}
 
-            result.emplace_front(sum < 0 ? -remainder : remainder);
-        }
+void big_integer::divide_two_big_integers(const big_integer &rhs,
+                                          big_integer &quotient,
+                                          big_integer &remainder) const {
+    if (this->is_nan() || rhs.is_nan() || rhs.is_zero()) {
+        quotient = big_integer::nan;
+        remainder = big_integer::nan;
+        return;
     }
 
-    const auto first_non_zero_digit_pos =
-            std::find_if(std::cbegin(result), std::cend(result), [](const auto digit) { return digit != 0; });
+    std::vector<limb_type> quotient_limbs{}, remainder_limbs{};
+    detail::divide_magnitudes(limbs_, rhs.limbs_, quotient_limbs, remainder_limbs);
 
-    if (first_non_zero_digit_pos != std::cbegin(result))
-        result.erase(std::cbegin(result), first_non_zero_digit_pos);
+    // the quotient is truncated towards zero and the remainder has the sign of the dividend
+    const bool is_negative_quotient{is_negative_number_ != rhs.is_negative_number_};
+    const bool is_negative_remainder{is_negative_number_};
 
-    if (result.front() < 0 || is_negative_addition) {
-        for (auto &digit : result) {
-            digit = digit > 0 ? -digit : digit;
-        }
-    }
+    quotient = from_limbs(std::move(quotient_limbs), is_negative_quotient);
+    remainder = from_limbs(std::move(remainder_limbs), is_negative_remainder);
+}
 
-    return big_integer{
-            std::vector<int>(std::make_move_iterator(std::begin(result)),
-                             std::make_move_iterator(std::end(result)))
-    };
+big_integer big_integer::square() const {
+    if (this->is_nan())
+        return big_integer::nan;
+
+    return from_limbs(detail::square_magnitude(limbs_));
 }
 
-big_integer big_integer::multiply_two_big_integers(
-        const big_integer &rhs) const {
-    if (this->is_zero() || rhs.is_zero())
-        return zero;
+big_integer big_integer::pow(const std::uint64_t exponent) const {
+    if (this->is_nan())
+        return big_integer::nan;
 
-    if (this->is_positive_one())
-        return rhs;
+    if (0U == exponent)
+        return big_integer::plus_one;
 
-    if (rhs.is_positive_one())
-        return *this;
+    if (limbs_.empty())
+        return big_integer::zero;
 
-    if (this->is_negative_one())
-        return -rhs;
+    const bool is_negative_result{is_negative_number_ && (exponent & 1U) != 0U};
 
-    if (rhs.is_negative_one())
-        return -(*this);
+    if (1U == limbs_.size() && 10U == limbs_.front())
+        return from_limbs(get_power_of_ten(exponent), is_negative_result);
 
-    std::vector<int> result{};
-    result.resize(decimal_digits_.size() + rhs.decimal_digits_.size(), 0);
+    // base = odd * 2^shift, thus base^exponent = odd^exponent * 2^(shift * exponent)
+    size_t zero_limb_count{};
+    while (0U == limbs_[zero_limb_count])
+        ++zero_limb_count;
 
-    const bool is_negative_product{
-            (is_negative_number_ && !rhs.is_negative_number_) || (!is_negative_number_ && rhs.is_negative_number_)
-    };
+    const size_t shift{zero_limb_count * detail::limb_bits + detail::count_trailing_zero_bits(limbs_[zero_limb_count])};
+    const std::vector<limb_type> odd_factor{detail::shift_magnitude_right(limbs_, shift)};
+    std::vector<limb_type> result{odd_factor};
 
-    for (size_t a{rhs.decimal_digits_.size()}; a > 0U; --a) {
-        const size_t i{a - 1};
-        int carry{};
-        for (size_t b{decimal_digits_.size()}; b > 0U; --b) {
-            const size_t j{b - 1};
-            int product =
-                    std::abs(decimal_digits_[j] * rhs.decimal_digits_[i]) + carry;
-            carry = product / 10;
-            product %= 10;
-            result[i + j + 1] += product;
-            carry += result[i + j + 1] / 10;
-            result[i + j + 1] %= 10;
+    if (odd_factor.size() != 1U || odd_factor.front() != 1U) {
+        for (size_t i{detail::limb_bits - 1 - detail::count_leading_zero_bits(exponent)}; i > 0U; --i) {
+            result = detail::square_magnitude(result);
+            if (((exponent >> (i - 1)) & 1U) != 0U)
+                result = detail::multiply_magnitudes(result, odd_factor);
         }
-
-        if (carry > 0)
-            result[i] = carry;
     }
 
-    const auto first_non_zero_digit_pos =
-            std::find_if(std::cbegin(result), std::cend(result), [](const auto digit) { return digit != 0; });
-
-    if (first_non_zero_digit_pos != std::cbegin(result))
-        result.erase(std::cbegin(result), first_non_zero_digit_pos);
-
-    big_integer multiplication{std::move(result)};
-
-    if (is_negative_product)
-        multiplication.invert_sign();
-
-    return multiplication;
+    return from_limbs(detail::shift_magnitude_left(result, shift * exponent), is_negative_result);
 }
 
 void big_integer::invert_sign() {
-    is_negative_number_ = !is_negative_number_;
-
-    for (auto &digit : decimal_digits_) {
-        auto abs_digit = std::abs(digit);
-        digit = is_negative_number_ && abs_digit != 0 ? -abs_digit : abs_digit;
-    }
+    if (is_nan_ || limbs_.empty())
+        return;
 
-    if (!is_negative_number_ && '-' == decimal_number_str_[0]) {
-        decimal_number_str_.erase(std::cbegin(decimal_number_str_));
-        --first_;
-        --last_;
-    } else if (is_negative_number_ && '-' != decimal_number_str_[0]) {
-        decimal_number_str_.insert(std::cbegin(decimal_number_str_), '-');
-        ++first_;
-        ++last_;
-    }
+    is_negative_number_ = !is_negative_number_;
 
-    update_big_integer_string_representations();
+    clear_cached_string_representations();
 }
 
 std::string big_integer::get_hexadecimal_number(
@@ -939,7 +803,7 @@ std::string big_integer::get_hexadecimal_number(
         const size_t number_of_digits) const {
     const size_t prefix_len{prefix.length()};
     const size_t postfix_len{postfix.length()};
-    std::string hex_number_str{this->hexadecimal_number_str_};
+    std::string hex_number_str{get_cached_number_in_power_of_two_base(hexadecimal_number_str_, "0x", 4U)};
     const size_t sign_offset{is_negative_number_ ? 1U : 0U};
 
     if (!prefix.empty() && !stl::helper::str_contains(hex_number_str, prefix, sign_offset)) {
@@ -978,7 +842,7 @@ std::string big_integer::get_octal_number(const std::string &prefix,
                                           const size_t number_of_digits) const {
     const size_t prefix_len{prefix.length()};
     const size_t postfix_len{postfix.length()};
-    std::string octal_number_str{this->octal_number_str_};
+    std::string octal_number_str{get_cached_number_in_power_of_two_base(octal_number_str_, "0o", 3U)};
     const size_t sign_offset{is_negative_number_ ? 1U : 0U};
 
     if (!prefix.empty() && !stl::helper::str_contains(octal_number_str, prefix, sign_offset)) {
@@ -1011,96 +875,59 @@ std::string big_integer::get_octal_number(const std::string &prefix,
 }
 
 void big_integer::set_big_integer_to_default_zero_value() {
-    decimal_digits_.assign({0});
-    binary_digits_.assign({false});
-    decimal_number_str_ = "0";
-    binary_number_str_ = "0b0";
-    octal_number_str_ = "0o0";
-    hexadecimal_number_str_ = "0x0";
+    limbs_.clear();
     base_ = number_base::decimal;
     is_negative_number_ = false;
-    first_ = 0;
-    last_ = 1;
+    is_nan_ = false;
+    clear_cached_string_representations();
 }
 
 void big_integer::set_big_integer_value_to_positive_one() {
-    decimal_digits_.assign({1});
-    binary_digits_.assign({true});
-    decimal_number_str_ = "1";
-    binary_number_str_ = "0b1";
-    octal_number_str_ = "0o1";
-    hexadecimal_number_str_ = "0x1";
+    limbs_.assign({1U});
     base_ = number_base::decimal;
     is_negative_number_ = false;
-    first_ = 0;
-    last_ = 1;
+    is_nan_ = false;
+    clear_cached_string_representations();
 }
 
 void big_integer::set_big_integer_value_to_negative_one() {
-    decimal_digits_.assign({-1});
-    binary_digits_.assign({true});
-    decimal_number_str_ = "-1";
-    binary_number_str_ = "-0b1";
-    octal_number_str_ = "-0o1";
-    hexadecimal_number_str_ = "-0x1";
+    limbs_.assign({1U});
     base_ = number_base::decimal;
     is_negative_number_ = true;
-    first_ = 1;
-    last_ = 2;
+    is_nan_ = false;
+    clear_cached_string_representations();
 }
 
 void big_integer::set_big_integer_value_nan() {
-    decimal_digits_.clear();
-    binary_digits_.clear();
-    decimal_number_str_ = "NaN";
-    binary_number_str_ = "NaN";
-    octal_number_str_ = "NaN";
-    hexadecimal_number_str_ = "NaN";
+    limbs_.clear();
     base_ = number_base::decimal;
     is_negative_number_ = false;
     is_nan_ = true;
-    first_ = 0;
-    last_ = 0;
+    clear_cached_string_representations();
 }
 
 void big_integer::check_and_process_binary_number_digits(
         std::vector<bool> binary_number) {
     if (binary_number.empty()) {
         set_big_integer_value_nan();
-    } else if (1U == binary_number.size() && 0 == binary_number.front()) {
-        set_big_integer_to_default_zero_value();
-    } else if (1U == binary_number.size() && 1 == binary_number.front()) {
-        set_big_integer_value_to_positive_one();
-    } else {
-        const auto first_true_iter_pos =
-                std::find(std::cbegin(binary_number), std::cend(binary_number), true);
+        return;
+    }
 
-        if (first_true_iter_pos == std::cend(binary_number)) {
-            set_big_integer_to_default_zero_value();
-        } else {
-            binary_number.erase(std::cbegin(binary_number), first_true_iter_pos);
+    std::vector<limb_type> limbs((binary_number.size() + detail::limb_bits - 1) / detail::limb_bits, 0U);
 
-            std::string binary_number_str{};
-            binary_number_str.reserve(binary_number.size() + 2);
-            binary_number_str.append("0b");
+    for (size_t i{}, bit_index{binary_number.size() - 1}; i < binary_number.size(); ++i, --bit_index) {
+        if (binary_number[i])
+            limbs[bit_index / detail::limb_bits] |= limb_type{1U} << (bit_index % detail::limb_bits);
+    }
 
-            for (bool binary_digit : binary_number) {
-                binary_number_str.push_back(binary_digit ? '1' : '0');
-            }
+    detail::trim_leading_zero_limbs(limbs);
 
-            decimal_number_str_ = binary_number_str;
-            binary_number_str_ = std::move(binary_number_str);
-            binary_digits_ = std::move(binary_number);
-            base_ = number_base::binary;
-            is_negative_number_ = false;
-            first_ = 2;
-            last_ = decimal_number_str_.length();
-
-            convert_number_to_decimal_and_store();
-            get_octal_digits_for_decimal_number();
-            get_hexadecimal_digits_for_decimal_number();
-        }
-    }
+    limbs_ = std::move(limbs);
+    base_ = number_base::binary;
+    is_negative_number_ = false;
+    is_nan_ = false;
+
+    clear_cached_string_representations();
 }
 
 bool big_integer::check_and_process_number_input_digits(
@@ -1111,70 +938,23 @@ bool big_integer::check_and_process_number_input_digits(
         return true;
     }
 
-    if (1U == number.size() && 0 == number.front()) {
-        set_big_integer_to_default_zero_value();
-        return true;
-    }
-
-    if (1U == number.size() && 1 == number.front()) {
-        set_big_integer_value_to_positive_one();
-        return true;
-    }
-
-    if (1U == number.size() && -1 == number.front()) {
-        set_big_integer_value_to_negative_one();
-        return true;
-    }
-
     const bool is_negative_number{number.front() < 0};
 
-    size_t first{};
-    std::string number_str{};
-    number_str.reserve(number.size() + (is_negative_number ? 1 : 0) + (base_ != number_base::decimal ? 2 : 0));
+    std::string digits{};
+    digits.reserve(number.size());
 
-    if (is_negative_number) {
-        number_str.push_back('-');
-        ++first;
-    }
-
-    switch (base_) {
-        case number_base::binary:
-            number_str.append("0b");
-            first += 2;
-            break;
-        case number_base::octal:
-            number_str.append("0o");
-            first += 2;
-            break;
-        case number_base::hexadecimal:
-            number_str.append("0x");
-            first += 2;
-            break;
-
-        default:
-            break;
-    }
-
-    for (int &digit : number) {
-        digit = std::abs(digit);
-        if (0U == number_base_allowed_digits_.at(base_).count(digit))
+    for (const int digit : number) {
+        const int abs_digit{std::abs(digit)};
+        if (0U == number_base_allowed_digits_.at(base_).count(abs_digit))
             return false;
 
-        number_str.push_back(
-                get_correct_digit_character_for_specified_value(digit));
-        digit = is_negative_number && digit != 0 ? -digit : digit;
+        digits.push_back(get_correct_digit_character_for_specified_value(abs_digit));
     }
 
-    decimal_number_str_ = std::move(number_str);
-    decimal_digits_ = std::move(number);
     is_negative_number_ = is_negative_number;
-    first_ = first;
-    last_ = decimal_number_str_.length();
-
-    if (base_ != number_base::decimal)
-        convert_number_to_decimal_and_store();
+    is_nan_ = false;
+    convert_digit_characters_to_limbs(digits);
 
-    update_big_integer_string_representations();
     return true;
 }
 
@@ -1255,47 +1035,18 @@ bool big_integer::check_and_process_number_input_characters(
         }
     }
 
-    decimal_number_str_.clear();
-    decimal_number_str_.reserve(last - first + (is_negative_number ? 1 : 0) + (base != number_base::decimal ? 2 : 0));
-
-    size_t start{};
-
-    if (is_negative_number) {
-        decimal_number_str_.push_back('-');
-        ++start;
-    }
-
-    if (base != number_base::decimal) {
-        switch (base) {
-            case number_base::binary:
-                decimal_number_str_.append("0b");
-                start += 2;
-                break;
-
-            case number_base::octal:
-                decimal_number_str_.append("0o");
-                start += 2;
-                break;
-
-            case number_base::hexadecimal:
-                decimal_number_str_.append("0x");
-                start += 2;
-                break;
-
-            default:
-                break;
-        }
-    }
+    std::string digits{};
+    digits.reserve(last - first);
 
     std::for_each(std::cbegin(number) + first, std::cbegin(number) + last, [&](const char digit) {
         if (digit != '_' && digit != '\'')
-            decimal_number_str_.push_back(digit);
+            digits.push_back(digit);
     });
 
     base_ = base;
     is_negative_number_ = is_negative_number;
-    first_ = start;
-    last_ = decimal_number_str_.length();
+    is_nan_ = false;
+    convert_digit_characters_to_limbs(digits);
 
     return true;
 }
@@ -1309,7 +1060,7 @@ char big_integer::get_correct_digit_character_for_specified_value(
     if (ch >= '0' && ch <= '9')
         return ch;
     if (ch >= 'a' && ch <= 'f')
-        return 'A' + ('a' - ch);
+        return 'A' + (ch - 'a');
     if (ch >= 'A' && ch <= 'F')
         return ch;
 
@@ -1355,276 +1106,232 @@ byte big_integer::get_correct_digit_value(const char ch) const noexcept {
     }
 }
 
-void big_integer::find_2s_complement_for_binary_number() {
-    std::vector<bool> binary_digits{};
-    binary_digits.reserve(binary_digits_.size());
+void big_integer::convert_digit_characters_to_limbs(const std::string &digits) {
+    if (base_ == number_base::decimal) {
+        limbs_ = convert_decimal_digits_to_limbs(digits.data(), digits.length());
+    } else {
+        std::string digit_values{digits};
 
-    std::transform(std::cbegin(binary_digits_), std::cend(binary_digits_), std::back_inserter(binary_digits),
-                   [](const bool bin_digit) { return !bin_digit; });
+        for (char &digit : digit_values)
+            digit = get_correct_digit_value(digit);
 
-    bool carry_bit{true};
+        limbs_ = convert_power_of_two_base_digits_to_limbs(digit_values, number_base_number_of_bits_.at(base_));
+    }
 
-    for (size_t index{binary_digits.size()}; index > 0; --index) {
-        const size_t i{index - 1};
-        const bool result{(carry_bit && !binary_digits.at(i)) || (!carry_bit && binary_digits.at(i))};
+    if (limbs_.empty())
+        is_negative_number_ = false;
 
-        carry_bit = carry_bit && binary_digits.at(i);
+    clear_cached_string_representations();
+}
 
-        binary_digits.at(i) = result;
+const std::vector<big_integer::limb_type> &big_integer::get_cached_power_of_ten(const size_t power_index) {
+    // powers_of_ten[i] holds (10^19)^(2^i), a deque keeps references to already computed powers valid
+    static std::deque<std::vector<limb_type>> powers_of_ten{std::vector<limb_type>{ten_to_the_power_of_19}};
+    static std::mutex powers_of_ten_mutex{};
+
+    std::lock_guard<std::mutex> lock{powers_of_ten_mutex};
+
+    while (powers_of_ten.size() <= power_index)
+        powers_of_ten.emplace_back(detail::multiply_magnitudes(powers_of_ten.back(), powers_of_ten.back()));
+
+    return powers_of_ten[power_index];
+}
+
+std::vector<big_integer::limb_type> big_integer::get_power_of_ten(const std::uint64_t exponent) {
+    // 10^exponent = 10^(exponent mod 19) * product of the cached (10^19)^(2^i) for the set bits i of exponent / 19
+    limb_type small_power{1U};
+    for (std::uint64_t i{}; i < exponent % decimal_digits_per_limb; ++i)
+        small_power *= 10U;
+
+    std::vector<limb_type> result{small_power};
+    std::uint64_t chunk_count{exponent / decimal_digits_per_limb};
+
+    for (size_t i{}; chunk_count != 0U; ++i, chunk_count >>= 1U) {
+        if ((chunk_count & 1U) != 0U)
+            result = detail::multiply_magnitudes(result, get_cached_power_of_ten(i));
     }
+
+    return result;
 }
 
-void big_integer::convert_number_to_decimal_and_store() {
-    if (base_ != number_base::decimal) {
-        // if (binary_digits_.empty()) {
-        binary_digits_.clear();
-        const byte number_of_bits_for_digit{number_base_number_of_bits_.at(base_)};
-
-        binary_digits_.reserve((last_ - first_) * number_of_bits_for_digit);
-
-        std::for_each(std::cbegin(decimal_number_str_) + first_,
-                      std::cbegin(decimal_number_str_) + last_,
-                      [&](const auto ch) {
-                          const byte digit{get_correct_digit_value(ch)};
-                          for (byte i{}; i < number_of_bits_for_digit; ++i) {
-                              const byte bit_mask{static_cast<byte>(
-                                                          1_b << (number_of_bits_for_digit - 1 - i))};
-                              const bool result{(digit & bit_mask) == bit_mask};
-                              binary_digits_.emplace_back(result);
-                          }
-                      });
-        // }
-
-        const size_t bcd_bin_buffer_size =
-                binary_digits_.size() + 4 * static_cast<size_t>(std::ceil(binary_digits_.size() / 3.0));
-
-        std::vector<bool> bcd_digits(bcd_bin_buffer_size, false);
-
-        for (size_t i{}; i < binary_digits_.size(); ++i) {
-            for (size_t j{bcd_bin_buffer_size}; j > 3U; j -= 4) {
-                const size_t k{j - 1};
-                unsigned value = (bcd_digits[k] ? 1 : 0) + (bcd_digits[k - 1] ? 2 : 0) + (bcd_digits[k - 2] ? 4 : 0) +
-                                 (bcd_digits[k - 3] ? 8 : 0);
-
-                if (value >= 5U) {
-                    value += 3U;
-                    bcd_digits[k] = (value & 1U) == 1U;
-                    bcd_digits[k - 1] = (value & 2U) == 2U;
-                    bcd_digits[k - 2] = (value & 4U) == 4U;
-                    bcd_digits[k - 3] = (value & 8U) == 8U;
-                }
-            }
+std::vector<big_integer::limb_type> big_integer::convert_decimal_digits_to_limbs(const char *digits,
+                                                                                const size_t digit_count) {
+    if (digit_count <= BIG_INTEGER_RADIX_CONVERSION_THRESHOLD * decimal_digits_per_limb)
+        return convert_decimal_digits_to_limbs_schoolbook(digits, digit_count);
 
-            for (size_t j{}; (j < bcd_digits.size() - 1); ++j)
-                bcd_digits[j] = bcd_digits[j + 1];
+    size_t power_index{};
 
-            bcd_digits.back() = binary_digits_[i];
-        }
+    while ((decimal_digits_per_limb << (power_index + 1)) < digit_count)
+        ++power_index;
 
-        if (bcd_digits.size() % 4 != 0) {
-            const size_t count_of_zeroes = bcd_digits.size() % 4;
-            bcd_digits.insert(std::cbegin(bcd_digits), 4 - count_of_zeroes, false);
-        }
+    const size_t lower_digit_count{decimal_digits_per_limb << power_index};
+    const size_t upper_digit_count{digit_count - lower_digit_count};
 
-        const size_t number_of_bcd_digits{bcd_digits.size() / 4};
+    const std::vector<limb_type> upper_limbs{convert_decimal_digits_to_limbs(digits, upper_digit_count)};
+    const std::vector<limb_type> lower_limbs{
+            convert_decimal_digits_to_limbs(digits + upper_digit_count, lower_digit_count)
+    };
+
+    std::vector<limb_type> limbs{detail::multiply_magnitudes(upper_limbs, get_cached_power_of_ten(power_index))};
+    limbs.resize(std::max(limbs.size(), lower_limbs.size()) + 1, 0U);
+    detail::add_limb_sequences(limbs.data(), limbs.data(), limbs.size(), lower_limbs.data(), lower_limbs.size());
+    detail::trim_leading_zero_limbs(limbs);
 
-        decimal_digits_.clear();
-        decimal_digits_.reserve(number_of_bcd_digits);
+    return limbs;
+}
 
-        decimal_number_str_.clear();
-        decimal_number_str_.reserve(number_of_bcd_digits + (is_negative_number_ ? 1 : 0));
+std::vector<big_integer::limb_type> big_integer::convert_decimal_digits_to_limbs_schoolbook(const char *digits,
+                                                                                           const size_t digit_count) {
+    std::vector<limb_type> limbs{};
+    limbs.reserve(digit_count / decimal_digits_per_limb + 1);
 
-        bool is_leading_zeroes{true};
-        // base_ = number_base::decimal;
-        first_ = 0U;
+    const size_t leading_chunk_length{digit_count % decimal_digits_per_limb};
 
-        if (is_negative_number_) {
-            decimal_number_str_.push_back('-');
-            ++first_;
-        }
+    for (size_t i{}; i < digit_count;) {
+        const size_t chunk_length{0U == i && leading_chunk_length != 0U ? leading_chunk_length : decimal_digits_per_limb};
+        limb_type chunk_value{};
+        limb_type multiplier{1U};
 
-        for (size_t i{}; i <= bcd_digits.size() - 4; i += 4) {
-            const byte value =
-                    (bcd_digits[i] ? 8_b : 0_b) + (bcd_digits[i + 1] ? 4_b : 0_b) + (bcd_digits[i + 2] ? 2_b : 0_b) +
-                    (bcd_digits[i + 3] ? 1_b : 0_b);
+        for (size_t j{}; j < chunk_length; ++j, ++i) {
+            chunk_value = chunk_value * 10U + static_cast<limb_type>(digits[i] - '0');
+            multiplier *= 10U;
+        }
 
-            if (is_leading_zeroes && value == 0)
-                continue;
+        limb_type carry{detail::multiply_limb_sequence_by_limb(limbs.data(), limbs.data(), limbs.size(), multiplier)};
 
-            decimal_digits_.emplace_back(is_negative_number_ ? -value : value);
-            decimal_number_str_.push_back('0' + value);
-            is_leading_zeroes = false;
+        for (size_t k{}; k < limbs.size() && chunk_value != 0U; ++k) {
+            limbs[k] += chunk_value;
+            chunk_value = limbs[k] < chunk_value ? 1U : 0U;
         }
 
-        last_ = decimal_number_str_.length();
-    } else {
-        decimal_digits_.clear();
-        decimal_digits_.reserve(last_ - first_);
-        std::for_each(std::cbegin(decimal_number_str_) + first_,
-                      std::cend(decimal_number_str_),
-                      [&](const auto ch) {
-                          const byte digit{static_cast<byte>(ch - '0')};
-                          decimal_digits_.emplace_back(
-                                  is_negative_number_ && 0 != digit ? -digit : digit);
-                      });
-
-        get_binary_digits_for_decimal_number();
+        carry += chunk_value;
+
+        if (carry != 0U)
+            limbs.emplace_back(carry);
     }
-}
 
-void big_integer::get_binary_digits_for_decimal_number() {
-    binary_digits_.clear();
-    binary_number_str_.clear();
+    detail::trim_leading_zero_limbs(limbs);
 
-    std::string number_str{std::cbegin(decimal_number_str_) + first_,
-                           std::cend(decimal_number_str_)};
+    return limbs;
+}
 
-    const size_t number_of_bits_needed_for_encoding_decimal_digits =
-            number_str.length() * number_base_number_of_bits_.at(number_base::decimal);
+std::vector<big_integer::limb_type> big_integer::convert_power_of_two_base_digits_to_limbs(const std::string &digits,
+                                                                                          const size_t bits_per_digit) {
+    std::vector<limb_type> limbs((digits.length() * bits_per_digit + detail::limb_bits - 1) / detail::limb_bits, 0U);
 
-    binary_digits_.reserve(number_of_bits_needed_for_encoding_decimal_digits);
-    binary_number_str_.reserve(number_of_bits_needed_for_encoding_decimal_digits + 2 + (is_negative_number_ ? 1 : 0));
+    size_t bit_position{};
 
-    while (number_str != "0") {
-        binary_digits_.emplace_back(
-                static_cast<bool>(odds_to_one(number_str.back())));
-        binary_number_str_.push_back('0' + odds_to_one(number_str.back()));
-        number_str = div_by_two(number_str);
-    }
+    for (size_t i{digits.length()}; i > 0U; --i, bit_position += bits_per_digit) {
+        const auto digit_value{static_cast<limb_type>(static_cast<unsigned char>(digits[i - 1]))};
+        const size_t limb_index{bit_position / detail::limb_bits};
+        const size_t bit_offset{bit_position % detail::limb_bits};
 
-    const size_t last_one_pos{binary_number_str_.find_last_of('1')};
-    binary_number_str_.erase(std::cbegin(binary_number_str_) + last_one_pos + 1,
-                             std::cend(binary_number_str_));
+        limbs[limb_index] |= digit_value << bit_offset;
 
-    binary_number_str_.append("b0");
+        if (bit_offset + bits_per_digit > detail::limb_bits)
+            limbs[limb_index + 1] |= digit_value >> (detail::limb_bits - bit_offset);
+    }
 
-    if (is_negative_number_)
-        binary_number_str_.push_back('-');
+    detail::trim_leading_zero_limbs(limbs);
 
-    std::reverse(std::begin(binary_number_str_), std::end(binary_number_str_));
-    std::reverse(std::begin(binary_digits_), std::end(binary_digits_));
+    return limbs;
 }
 
-void big_integer::get_octal_digits_for_decimal_number() {
-    const auto number_of_bits_needed_for_one_octal_digit{
-            number_base_number_of_bits_.at(number_base::octal)
-    };
+std::string big_integer::convert_limbs_to_decimal_digits(const std::vector<limb_type> &limbs) {
+    if (limbs.empty())
+        return "0";
 
-    const size_t remainder{binary_digits_.size() % number_of_bits_needed_for_one_octal_digit};
-    if (remainder != 0)
-        binary_digits_.insert(std::cbegin(binary_digits_),
-                              number_of_bits_needed_for_one_octal_digit - remainder,
-                              false);
+    std::string digits{};
+    digits.reserve(limbs.size() * 20U);
+    append_decimal_digits(digits, limbs, 0U);
 
-    octal_number_str_.clear();
-    octal_number_str_.reserve(
-            binary_digits_.size() / number_of_bits_needed_for_one_octal_digit + 2 + (is_negative_number_ ? 1 : 0));
+    return digits;
+}
 
-    bool is_leading_zeroes{true};
+void big_integer::append_decimal_digits(std::string &digits,
+                                        const std::vector<limb_type> &limbs,
+                                        const size_t minimum_digit_count) {
+    if (limbs.size() <= BIG_INTEGER_RADIX_CONVERSION_THRESHOLD) {
+        append_decimal_digits_schoolbook(digits, limbs, minimum_digit_count);
+        return;
+    }
 
-    if (is_negative_number_)
-        octal_number_str_.push_back('-');
+    size_t power_index{};
 
-    octal_number_str_.append("0o");
+    while (get_cached_power_of_ten(power_index + 1).size() <= (limbs.size() + 1) / 2)
+        ++power_index;
 
-    for (size_t i{};
-         i <= binary_digits_.size() - number_of_bits_needed_for_one_octal_digit;
-         i += number_of_bits_needed_for_one_octal_digit) {
-        const byte value = (binary_digits_[i] ? 4_b : 0_b) + (binary_digits_[i + 1] ? 2_b : 0_b) +
-                           (binary_digits_[i + 2] ? 1_b : 0_b);
+    const size_t lower_digit_count{decimal_digits_per_limb << power_index};
 
-        if (value == 0 && is_leading_zeroes)
-            continue;
+    std::vector<limb_type> quotient{}, remainder{};
+    detail::divide_magnitudes(limbs, get_cached_power_of_ten(power_index), quotient, remainder);
 
-        octal_number_str_.push_back('0' + value);
-        is_leading_zeroes = false;
-    }
+    append_decimal_digits(digits, quotient,
+                          minimum_digit_count > lower_digit_count ? minimum_digit_count - lower_digit_count : 0U);
+    append_decimal_digits(digits, remainder, lower_digit_count);
 }
 
-void big_integer::get_hexadecimal_digits_for_decimal_number() {
-    const auto number_of_bits_needed_for_one_hex_digit{
-            number_base_number_of_bits_.at(number_base::hexadecimal)
-    };
+void big_integer::append_decimal_digits_schoolbook(std::string &digits,
+                                                   const std::vector<limb_type> &limbs,
+                                                   const size_t minimum_digit_count) {
+    std::vector<limb_type> quotient{limbs};
+    std::vector<limb_type> chunks{};
+    chunks.reserve(limbs.size() + limbs.size() / 5 + 1);
 
-    const size_t remainder{binary_digits_.size() % number_of_bits_needed_for_one_hex_digit};
-    if (remainder != 0)
-        binary_digits_.insert(std::cbegin(binary_digits_),
-                              number_of_bits_needed_for_one_hex_digit - remainder,
-                              false);
+    while (!quotient.empty())
+        chunks.emplace_back(detail::divide_magnitude_by_limb(quotient, ten_to_the_power_of_19));
 
-    hexadecimal_number_str_.clear();
-    hexadecimal_number_str_.reserve(
-            binary_digits_.size() / number_of_bits_needed_for_one_hex_digit + 2 + (is_negative_number_ ? 1 : 0));
+    const std::string leading_chunk{chunks.empty() ? std::string{} : std::to_string(chunks.back())};
+    const size_t digit_count{chunks.empty() ? 0U
+                                            : leading_chunk.length() + (chunks.size() - 1) * decimal_digits_per_limb};
 
-    bool is_leading_zeroes{true};
+    if (digit_count < minimum_digit_count)
+        digits.append(minimum_digit_count - digit_count, '0');
 
-    if (is_negative_number_)
-        hexadecimal_number_str_.push_back('-');
+    digits += leading_chunk;
 
-    hexadecimal_number_str_.append("0x");
+    for (size_t i{chunks.size() > 0U ? chunks.size() - 1 : 0U}; i > 0U; --i) {
+        limb_type chunk{chunks[i - 1]};
+        char buffer[decimal_digits_per_limb];
 
-    for (size_t i{};
-         i <= binary_digits_.size() - number_of_bits_needed_for_one_hex_digit;
-         i += number_of_bits_needed_for_one_hex_digit) {
-        const byte value = (binary_digits_[i] ? 8_b : 0_b) + (binary_digits_[i + 1] ? 4_b : 0_b) +
-                           (binary_digits_[i + 2] ? 2_b : 0_b) + (binary_digits_[i + 3] ? 1_b : 0_b);
-
-        if (value == 0 && is_leading_zeroes)
-            continue;
+        for (size_t j{decimal_digits_per_limb}; j > 0U; --j) {
+            buffer[j - 1] = static_cast<char>('0' + chunk % 10U);
+            chunk /= 10U;
+        }
 
-        hexadecimal_number_str_.push_back(
-                get_correct_digit_character_for_specified_value(value));
-        is_leading_zeroes = false;
+        digits.append(buffer, decimal_digits_per_limb);
     }
 }
 
-std::string big_integer::div_by_two(const std::string &number_str) {
-    std::string modified_number_str{};
-    byte add{};
+std::string big_integer::convert_limbs_to_power_of_two_base_digits(const std::vector<limb_type> &limbs,
+                                                                   const size_t bits_per_digit) {
+    if (limbs.empty())
+        return "0";
 
-    for (const char digit : number_str) {
-        const byte new_digit{static_cast<byte>((digit - '0') / 2 + add)};
-        modified_number_str.push_back('0' + new_digit);
-        add = odds_to_one(digit) * 5;
-    }
+    const size_t bit_length{detail::get_bit_length(limbs)};
+    const size_t digit_count{(bit_length + bits_per_digit - 1) / bits_per_digit};
+    const limb_type digit_mask{(limb_type{1U} << bits_per_digit) - 1};
 
-    if (modified_number_str != "0" && modified_number_str.length() > 1U && modified_number_str.front() == '0') {
-        return modified_number_str.substr(1);
-    }
+    std::string digits(digit_count, '0');
 
-    return modified_number_str;
-}
+    for (size_t i{}, bit_position{}; i < digit_count; ++i, bit_position += bits_per_digit) {
+        const size_t limb_index{bit_position / detail::limb_bits};
+        const size_t bit_offset{bit_position % detail::limb_bits};
 
-byte big_integer::odds_to_one(const char ch) {
-    switch (ch) {
-        case '1':
-        case '3':
-        case '5':
-        case '7':
-        case '9':
-            return 1;
-        default:
-            return 0;
+        limb_type digit_value{limbs[limb_index] >> bit_offset};
+
+        if (bit_offset + bits_per_digit > detail::limb_bits && limb_index + 1 < limbs.size())
+            digit_value |= limbs[limb_index + 1] << (detail::limb_bits - bit_offset);
+
+        digits[digit_count - 1 - i] = get_correct_digit_character_for_specified_value(static_cast<int>(digit_value & digit_mask));
     }
+
+    return digits;
 }
 
 void big_integer::assign(const std::string &number) {
-    if (stl::helper::str_starts_with(number, NaN, true)) {
-        set_big_integer_value_nan();
-    } else if (!check_and_process_number_input_characters(number)) {
-#ifndef BIG_INTEGER_NO_THROW
-        throw std::invalid_argument{
-          "Input number string does not contain a valid number!"
-        };
-#else
-        set_big_integer_value_nan();
-#endif
-    }
-
-    if (!is_zero() && !is_positive_one() && !is_negative_one() && !is_nan()) {
-        convert_number_to_decimal_and_store();
-        update_big_integer_string_representations();
-    }
+    big_integer temp{number};
+    this->swap(temp);
 }
 
 void big_integer::assign(std::vector<int> number_digits,
@@ -1638,8 +1345,33 @@ void big_integer::assign(std::vector<bool> binary_number_digits) {
     this->swap(temp);
 }
 
-void big_integer::update_big_integer_string_representations() {
-    get_binary_digits_for_decimal_number();
-    get_octal_digits_for_decimal_number();
-    get_hexadecimal_digits_for_decimal_number();
+void big_integer::clear_cached_string_representations() noexcept {
+    decimal_digits_.reset();
+    binary_digits_.reset();
+    hexadecimal_number_str_.reset();
+    decimal_number_str_.reset();
+    octal_number_str_.reset();
+    binary_number_str_.reset();
+}
+
+const std::string &big_integer::get_cached_decimal_number() const {
+    return get_or_create_cached_representation(decimal_number_str_, [this]() {
+        if (is_nan_)
+            return std::string{NaN};
+
+        return (is_negative_number_ ? std::string{"-"} : std::string{}) + convert_limbs_to_decimal_digits(limbs_);
+    });
+}
+
+const std::string &big_integer::get_cached_number_in_power_of_two_base(
+        std::shared_ptr<const std::string> &cached_number_str,
+        const char *prefix,
+        const size_t bits_per_digit) const {
+    return get_or_create_cached_representation(cached_number_str, [this, prefix, bits_per_digit]() {
+        if (is_nan_)
+            return std::string{NaN};
+
+        return (is_negative_number_ ? std::string{"-"} : std::string{}) + prefix +
+               convert_limbs_to_power_of_two_base_digits(limbs_, bits_per_digit);
+    });
 }
@@ -0,0 +1,236 @@
+#include "../include/combinatorics.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace org::atib::numerics;
+
+namespace {
+
+    using limb_type = detail::limb_type;
+    using limb_vector = detail::limb_vector;
+
+    // factors of a product tree leaf, multiplied one limb at a time
+    constexpr const size_t product_leaf_size{16U};
+
+    // the primes up to limit by an odd-only sieve of Eratosthenes
+    limb_vector sieve_primes(const std::uint64_t limit) {
+        limb_vector primes{};
+        if (limit < 2U)
+            return primes;
+
+        primes.emplace_back(2U);
+
+        // is_composite[i] for 2 * i + 1
+        std::vector<bool> is_composite((limit - 1) / 2 + 1, false);
+        for (std::uint64_t i{1U}; i < is_composite.size(); ++i) {
+            if (is_composite[i])
+                continue;
+
+            const std::uint64_t prime{2 * i + 1};
+            primes.emplace_back(prime);
+
+            if (prime <= limit / prime) {
+                for (std::uint64_t multiple{prime * prime}; multiple <= limit; multiple += 2 * prime)
+                    is_composite[multiple / 2] = true;
+            }
+        }
+
+        return primes;
+    }
+
+    // factors[begin, end) multiplied by binary splitting
+    big_integer multiply_limb_range(const limb_vector &factors, const size_t begin, const size_t end) {
+        if (end - begin <= product_leaf_size) {
+            limb_vector product{1U};
+            product.reserve(end - begin + 1);
+
+            for (size_t i{begin}; i < end; ++i) {
+                const limb_type carry{detail::multiply_limb_sequence_by_limb(
+                        product.data(), product.data(), product.size(), factors[i])};
+                if (carry != 0U)
+                    product.emplace_back(carry);
+            }
+
+            return big_integer::from_limbs(std::move(product));
+        }
+
+        const size_t middle{begin + (end - begin) / 2};
+        return multiply_limb_range(factors, begin, middle) * multiply_limb_range(factors, middle, end);
+    }
+
+    // The product of positive factors. Consecutive factors are first combined into single limbs, so that every leaf
+    // of the tree contributes about the same number of limbs.
+    big_integer multiply_factors(const limb_vector &factors) {
+        limb_vector packed_factors{};
+        limb_type packed_factor{1U};
+
+        for (const limb_type factor : factors) {
+            if (packed_factor > std::numeric_limits<limb_type>::max() / factor) {
+                packed_factors.emplace_back(packed_factor);
+                packed_factor = 1U;
+            }
+            packed_factor *= factor;
+        }
+        packed_factors.emplace_back(packed_factor);
+
+        return multiply_limb_range(packed_factors, 0U, packed_factors.size());
+    }
+
+    // The product of primes[i]^exponents[i]. The primes whose exponent has bit j set are multiplied into P_j, and the
+    // result is the product of P_j^(2^j) by squaring from the highest bit down.
+    big_integer multiply_prime_powers(const limb_vector &primes, const std::vector<std::uint64_t> &exponents) {
+        std::uint64_t combined_exponent{};
+        for (const std::uint64_t exponent : exponents)
+            combined_exponent |= exponent;
+
+        big_integer result{big_integer::plus_one};
+        for (size_t bit{detail::limb_bits - detail::count_leading_zero_bits(combined_exponent)}; bit > 0U;) {
+            --bit;
+
+            limb_vector factors{};
+            for (size_t i{}; i < primes.size(); ++i) {
+                if (((exponents[i] >> bit) & 1U) != 0U)
+                    factors.emplace_back(primes[i]);
+            }
+
+            result = result.square() * multiply_factors(factors);
+        }
+
+        return result;
+    }
+
+    // the exponent of prime in n! by Legendre's formula
+    std::uint64_t get_factorial_exponent(std::uint64_t n, const std::uint64_t prime) noexcept {
+        std::uint64_t exponent{};
+        while ((n /= prime) > 0U)
+            exponent += n;
+        return exponent;
+    }
+
+    // The odd part of swing(n) = n! / (n / 2)!^2. Prime p occurs in it to the power sum_k (n / p^k mod 2), at most
+    // once for p^2 > n.
+    big_integer compute_odd_swing(const std::uint64_t n, const limb_vector &primes) {
+        limb_vector factors{};
+
+        for (size_t i{1U}; i < primes.size() && primes[i] <= n; ++i) {
+            const limb_type prime{primes[i]};
+
+            if (prime > n / prime) {
+                if (((n / prime) & 1U) != 0U)
+                    factors.emplace_back(prime);
+                continue;
+            }
+
+            limb_type power{1U};
+            for (std::uint64_t quotient{n / prime}; quotient > 0U; quotient /= prime) {
+                if ((quotient & 1U) != 0U)
+                    power *= prime;
+            }
+            if (power != 1U)
+                factors.emplace_back(power);
+        }
+
+        return multiply_factors(factors);
+    }
+
+    // the odd part of n!, (n / 2)!'s odd part squared times the odd part of swing(n)
+    big_integer compute_odd_factorial(const std::uint64_t n, const limb_vector &primes) {
+        // 20! is the largest factorial that fits in a limb
+        if (n <= 20U) {
+            limb_type odd_factorial{1U};
+            for (limb_type factor{3U}; factor <= n; ++factor)
+                odd_factorial *= factor >> detail::count_trailing_zero_bits(factor);
+            return big_integer{odd_factorial};
+        }
+
+        return compute_odd_factorial(n / 2, primes).square() * compute_odd_swing(n, primes);
+    }
+
+    // numbers[begin, end) multiplied as a balanced tree, the left subtree on a thread of its own while more than one
+    // thread is left
+    big_integer multiply_range(const std::vector<big_integer> &numbers,
+                               const size_t begin,
+                               const size_t end,
+                               const size_t thread_count) {
+        if (end - begin < 2U)
+            return begin == end ? big_integer::plus_one : numbers[begin];
+
+        if (2U == end - begin)
+            return numbers[begin] * numbers[begin + 1];
+
+        const size_t middle{begin + (end - begin) / 2};
+        if (thread_count < 2U)
+            return multiply_range(numbers, begin, middle, 1U) * multiply_range(numbers, middle, end, 1U);
+
+        big_integer left_product{};
+        std::thread worker{[&]() { left_product = multiply_range(numbers, begin, middle, thread_count / 2); }};
+        const big_integer right_product{multiply_range(numbers, middle, end, thread_count - thread_count / 2)};
+        worker.join();
+
+        return left_product * right_product;
+    }
+
+}// namespace
+
+big_integer org::atib::numerics::factorial(const std::uint64_t n) {
+    const limb_vector primes{n > 20U ? sieve_primes(n) : limb_vector{}};
+    return compute_odd_factorial(n, primes) << get_factorial_exponent(n, 2U);
+}
+
+big_integer org::atib::numerics::binomial(const std::uint64_t n, const std::uint64_t k) {
+    if (k > n)
+        return big_integer{};
+
+    const std::uint64_t smaller{std::min(k, n - k)};
+    if (0U == smaller)
+        return big_integer::plus_one;
+
+    // sieving up to n does not pay off when the result only has about k * log2(n / k) bits
+    if (smaller < n / 16) {
+        limb_vector factors(smaller);
+        for (std::uint64_t i{}; i < smaller; ++i)
+            factors[i] = n - i;
+        return multiply_factors(factors) / factorial(smaller);
+    }
+
+    const limb_vector primes{sieve_primes(n)};
+    std::vector<std::uint64_t> exponents(primes.size());
+
+    for (size_t i{}; i < primes.size(); ++i) {
+        exponents[i] = get_factorial_exponent(n, primes[i]) - get_factorial_exponent(k, primes[i]) -
+                       get_factorial_exponent(n - k, primes[i]);
+    }
+
+    return multiply_prime_powers(primes, exponents);
+}
+
+big_integer org::atib::numerics::double_factorial(const std::uint64_t n) {
+    if (n < 2U)
+        return big_integer::plus_one;
+
+    // (2m)!! = 2^m * m!
+    if (0U == n % 2)
+        return factorial(n / 2) << (n / 2);
+
+    // (2m + 1)!! = (2m + 1)! / (2^m * m!), the odd primes occur in it to the difference of their exponents
+    const std::uint64_t half{n / 2};
+    const limb_vector primes{sieve_primes(n)};
+    std::vector<std::uint64_t> exponents(primes.size());
+
+    for (size_t i{1U}; i < primes.size(); ++i)
+        exponents[i] = get_factorial_exponent(n, primes[i]) - get_factorial_exponent(half, primes[i]);
+
+    return multiply_prime_powers(primes, exponents);
+}
+
+big_integer org::atib::numerics::primorial(const std::uint64_t n) {
+    return multiply_factors(sieve_primes(n));
+}
+
+big_integer org::atib::numerics::product(const std::vector<big_integer> &numbers, const size_t thread_count) {
+    const size_t worker_count{0U == thread_count ? std::max(std::thread::hardware_concurrency(), 1U) : thread_count};
+    return multiply_range(numbers, 0U, numbers.size(), worker_count);
+}
@@ -0,0 +1,406 @@
+#include "../include/limb_arithmetic.h"
+
+#include <algorithm>
+
+using namespace org::atib::numerics;
+using namespace org::atib::numerics::detail;
+
+int org::atib::numerics::detail::compare_limb_sequences(const limb_type *lhs,
+                                                        const limb_type *rhs,
+                                                        size_t size) noexcept {
+    while (size > 0U) {
+        --size;
+        if (lhs[size] != rhs[size])
+            return lhs[size] < rhs[size] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+limb_type org::atib::numerics::detail::add_limb_sequences(limb_type *result,
+                                                          const limb_type *lhs,
+                                                          const size_t lhs_size,
+                                                          const limb_type *rhs,
+                                                          const size_t rhs_size) noexcept {
+    limb_type carry{};
+    size_t i{};
+
+    for (; i < rhs_size; ++i) {
+        const limb_type sum{lhs[i] + rhs[i]};
+        const limb_type carry_out{static_cast<limb_type>(sum < lhs[i])};
+        result[i] = sum + carry;
+        carry = carry_out | static_cast<limb_type>(result[i] < sum);
+    }
+
+    for (; i < lhs_size; ++i) {
+        result[i] = lhs[i] + carry;
+        carry = static_cast<limb_type>(result[i] < carry);
+    }
+
+    return carry;
+}
+
+limb_type org::atib::numerics::detail::subtract_limb_sequences(limb_type *result,
+                                                               const limb_type *lhs,
+                                                               const size_t lhs_size,
+                                                               const limb_type *rhs,
+                                                               const size_t rhs_size) noexcept {
+    limb_type borrow{};
+    size_t i{};
+
+    for (; i < rhs_size; ++i) {
+        const limb_type difference{lhs[i] - rhs[i]};
+        const limb_type borrow_out{static_cast<limb_type>(lhs[i] < rhs[i])};
+        result[i] = difference - borrow;
+        borrow = borrow_out | static_cast<limb_type>(difference < borrow);
+    }
+
+    for (; i < lhs_size; ++i) {
+        const limb_type value{lhs[i]};
+        result[i] = value - borrow;
+        borrow = static_cast<limb_type>(value < borrow);
+    }
+
+    return borrow;
+}
+
+limb_type org::atib::numerics::detail::multiply_limb_sequence_by_limb(limb_type *result,
+                                                                      const limb_type *limbs,
+                                                                      const size_t size,
+                                                                      const limb_type multiplier) noexcept {
+    limb_type carry{};
+
+    for (size_t i{}; i < size; ++i) {
+        limb_type high;
+        const limb_type low{multiply_two_limbs(limbs[i], multiplier, high)};
+        result[i] = low + carry;
+        carry = high + static_cast<limb_type>(result[i] < low);
+    }
+
+    return carry;
+}
+
+limb_type org::atib::numerics::detail::multiply_add_limb_sequence_by_limb(limb_type *result,
+                                                                          const limb_type *limbs,
+                                                                          const size_t size,
+                                                                          const limb_type multiplier) noexcept {
+    limb_type carry{};
+
+    for (size_t i{}; i < size; ++i) {
+        limb_type high;
+        limb_type low{multiply_two_limbs(limbs[i], multiplier, high)};
+        low += carry;
+        high += static_cast<limb_type>(low < carry);
+        result[i] += low;
+        carry = high + static_cast<limb_type>(result[i] < low);
+    }
+
+    return carry;
+}
+
+limb_type org::atib::numerics::detail::multiply_subtract_limb_sequence_by_limb(limb_type *result,
+                                                                               const limb_type *limbs,
+                                                                               const size_t size,
+                                                                               const limb_type multiplier) noexcept {
+    limb_type borrow{};
+
+    for (size_t i{}; i < size; ++i) {
+        limb_type high;
+        limb_type low{multiply_two_limbs(limbs[i], multiplier, high)};
+        low += borrow;
+        high += static_cast<limb_type>(low < borrow);
+        const limb_type value{result[i]};
+        result[i] = value - low;
+        borrow = high + static_cast<limb_type>(value < low);
+    }
+
+    return borrow;
+}
+
+void org::atib::numerics::detail::multiply_limb_sequences_schoolbook(limb_type *result,
+                                                                     const limb_type *lhs,
+                                                                     const size_t lhs_size,
+                                                                     const limb_type *rhs,
+                                                                     const size_t rhs_size) noexcept {
+    result[lhs_size] = multiply_limb_sequence_by_limb(result, lhs, lhs_size, rhs[0]);
+
+    for (size_t i{1}; i < rhs_size; ++i)
+        result[lhs_size + i] = multiply_add_limb_sequence_by_limb(result + i, lhs, lhs_size, rhs[i]);
+}
+
+void org::atib::numerics::detail::square_limb_sequence_schoolbook(limb_type *result,
+                                                                 const limb_type *limbs,
+                                                                 const size_t size) noexcept {
+    std::fill(result, result + 2 * size, limb_type{});
+
+    // every cross product limbs[i] * limbs[j] with i < j is computed once and doubled below
+    for (size_t i{}; i + 1 < size; ++i)
+        result[i + size] = multiply_add_limb_sequence_by_limb(result + 2 * i + 1, limbs + i + 1, size - i - 1,
+                                                              limbs[i]);
+
+    limb_type shifted_out_bit{}, carry{};
+
+    for (size_t i{}; i < size; ++i) {
+        limb_type square_high;
+        const limb_type square_low{multiply_two_limbs(limbs[i], limbs[i], square_high)};
+
+        const limb_type doubled_low{(result[2 * i] << 1U) | shifted_out_bit};
+        const limb_type doubled_high{(result[2 * i + 1] << 1U) | (result[2 * i] >> (limb_bits - 1))};
+        shifted_out_bit = result[2 * i + 1] >> (limb_bits - 1);
+
+        limb_type low_sum{doubled_low + square_low};
+        limb_type low_carry{static_cast<limb_type>(low_sum < square_low)};
+        low_sum += carry;
+        low_carry += static_cast<limb_type>(low_sum < carry);
+
+        limb_type high_sum{doubled_high + square_high};
+        carry = static_cast<limb_type>(high_sum < square_high);
+        high_sum += low_carry;
+        carry += static_cast<limb_type>(high_sum < low_carry);
+
+        result[2 * i] = low_sum;
+        result[2 * i + 1] = high_sum;
+    }
+}
+
+int org::atib::numerics::detail::compare_magnitudes(const limb_vector &lhs, const limb_vector &rhs) noexcept {
+    if (lhs.size() != rhs.size())
+        return lhs.size() < rhs.size() ? -1 : 1;
+
+    return compare_limb_sequences(lhs.data(), rhs.data(), lhs.size());
+}
+
+limb_vector org::atib::numerics::detail::add_magnitudes(const limb_vector &lhs, const limb_vector &rhs) {
+    const bool is_lhs_longer{lhs.size() >= rhs.size()};
+    const limb_vector &longer{is_lhs_longer ? lhs : rhs};
+    const limb_vector &shorter{is_lhs_longer ? rhs : lhs};
+
+    limb_vector result(longer.size() + 1, 0U);
+    result.back() = add_limb_sequences(result.data(), longer.data(), longer.size(), shorter.data(), shorter.size());
+    trim_leading_zero_limbs(result);
+
+    return result;
+}
+
+limb_vector org::atib::numerics::detail::subtract_magnitudes(const limb_vector &lhs, const limb_vector &rhs) {
+    limb_vector result(lhs.size(), 0U);
+    subtract_limb_sequences(result.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    trim_leading_zero_limbs(result);
+
+    return result;
+}
+
+limb_vector org::atib::numerics::detail::multiply_magnitudes(const limb_vector &lhs, const limb_vector &rhs) {
+    if (lhs.empty() || rhs.empty())
+        return {};
+
+    limb_vector result(lhs.size() + rhs.size(), 0U);
+    multiply_limb_sequences(result.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+
+    trim_leading_zero_limbs(result);
+
+    return result;
+}
+
+limb_vector org::atib::numerics::detail::square_magnitude(const limb_vector &limbs) {
+    if (limbs.empty())
+        return {};
+
+    limb_vector result(2 * limbs.size());
+    square_limb_sequence(result.data(), limbs.data(), limbs.size());
+    trim_leading_zero_limbs(result);
+
+    return result;
+}
+
+limb_type org::atib::numerics::detail::divide_magnitude_by_limb(limb_vector &limbs, const limb_type divisor) noexcept {
+    limb_type remainder{};
+
+    for (size_t i{limbs.size()}; i > 0U; --i)
+        limbs[i - 1] = divide_double_limb(remainder, limbs[i - 1], divisor, remainder);
+
+    trim_leading_zero_limbs(limbs);
+
+    return remainder;
+}
+
+limb_type org::atib::numerics::detail::get_magnitude_remainder(const limb_vector &limbs,
+                                                              const limb_type divisor) noexcept {
+    limb_type remainder{};
+    for (size_t i{limbs.size()}; i > 0U; --i)
+        divide_double_limb(remainder, limbs[i - 1], divisor, remainder);
+    return remainder;
+}
+
+limb_type org::atib::numerics::detail::raise_modulo_limb(limb_type base,
+                                                        std::uint64_t exponent,
+                                                        const limb_type modulus) noexcept {
+    limb_type result{1U % modulus};
+    for (base %= modulus; exponent != 0U; exponent >>= 1U) {
+        if ((exponent & 1U) != 0U)
+            result = multiply_modulo_limb(result, base, modulus);
+        base = multiply_modulo_limb(base, base, modulus);
+    }
+    return result;
+}
+
+void org::atib::numerics::detail::divide_magnitudes_knuth(const limb_vector &dividend,
+                                                         const limb_vector &divisor,
+                                                         limb_vector &quotient,
+                                                         limb_vector &remainder) {
+    if (compare_magnitudes(dividend, divisor) < 0) {
+        remainder = dividend;
+        quotient.clear();
+        return;
+    }
+
+    if (1U == divisor.size()) {
+        quotient = dividend;
+        const limb_type last_remainder{divide_magnitude_by_limb(quotient, divisor.front())};
+        remainder.assign(1U, last_remainder);
+        trim_leading_zero_limbs(remainder);
+        return;
+    }
+
+    const size_t divisor_size{divisor.size()};
+    const size_t quotient_size{dividend.size() - divisor_size + 1};
+    const size_t normalization_shift{count_leading_zero_bits(divisor.back())};
+
+    limb_vector normalized_divisor(divisor_size);
+    limb_vector normalized_dividend(dividend.size() + 1);
+
+    if (0U == normalization_shift) {
+        std::copy(std::cbegin(divisor), std::cend(divisor), std::begin(normalized_divisor));
+        std::copy(std::cbegin(dividend), std::cend(dividend), std::begin(normalized_dividend));
+        normalized_dividend.back() = 0U;
+    } else {
+        for (size_t i{divisor_size - 1}; i > 0U; --i)
+            normalized_divisor[i] = (divisor[i] << normalization_shift) |
+                                    (divisor[i - 1] >> (limb_bits - normalization_shift));
+        normalized_divisor[0] = divisor[0] << normalization_shift;
+
+        normalized_dividend.back() = dividend.back() >> (limb_bits - normalization_shift);
+        for (size_t i{dividend.size() - 1}; i > 0U; --i)
+            normalized_dividend[i] = (dividend[i] << normalization_shift) |
+                                     (dividend[i - 1] >> (limb_bits - normalization_shift));
+        normalized_dividend[0] = dividend[0] << normalization_shift;
+    }
+
+    const limb_type divisor_high{normalized_divisor[divisor_size - 1]};
+    const limb_type divisor_next{normalized_divisor[divisor_size - 2]};
+
+    quotient.assign(quotient_size, 0U);
+
+    for (size_t j{quotient_size}; j > 0U; --j) {
+        limb_type *window{normalized_dividend.data() + j - 1};
+        limb_type quotient_estimate, remainder_estimate;
+        bool is_remainder_overflown{};
+
+        if (window[divisor_size] >= divisor_high) {
+            quotient_estimate = max_limb_value;
+            remainder_estimate = window[divisor_size - 1] + divisor_high;
+            is_remainder_overflown = remainder_estimate < divisor_high;
+        } else {
+            quotient_estimate = divide_double_limb(window[divisor_size], window[divisor_size - 1], divisor_high,
+                                                   remainder_estimate);
+        }
+
+        while (!is_remainder_overflown) {
+            limb_type product_high;
+            const limb_type product_low{multiply_two_limbs(quotient_estimate, divisor_next, product_high)};
+
+            if (product_high < remainder_estimate ||
+                (product_high == remainder_estimate && product_low <= window[divisor_size - 2]))
+                break;
+
+            --quotient_estimate;
+            remainder_estimate += divisor_high;
+            is_remainder_overflown = remainder_estimate < divisor_high;
+        }
+
+        const limb_type borrow{multiply_subtract_limb_sequence_by_limb(window, normalized_divisor.data(),
+                                                                       divisor_size, quotient_estimate)};
+        const limb_type window_high{window[divisor_size]};
+        window[divisor_size] = window_high - borrow;
+
+        if (window_high < borrow) {
+            --quotient_estimate;
+            window[divisor_size] += add_limb_sequences(window, window, divisor_size, normalized_divisor.data(),
+                                                       divisor_size);
+        }
+
+        quotient[j - 1] = quotient_estimate;
+    }
+
+    remainder.assign(divisor_size, 0U);
+
+    if (0U == normalization_shift) {
+        std::copy(std::cbegin(normalized_dividend), std::cbegin(normalized_dividend) + divisor_size,
+                  std::begin(remainder));
+    } else {
+        for (size_t i{}; i < divisor_size; ++i)
+            remainder[i] = (normalized_dividend[i] >> normalization_shift) |
+                           (normalized_dividend[i + 1] << (limb_bits - normalization_shift));
+    }
+
+    trim_leading_zero_limbs(quotient);
+    trim_leading_zero_limbs(remainder);
+}
+
+limb_vector org::atib::numerics::detail::shift_magnitude_left(const limb_vector &limbs, const size_t bit_count) {
+    if (limbs.empty())
+        return {};
+
+    const size_t limb_shift{bit_count / limb_bits};
+    const size_t bit_shift{bit_count % limb_bits};
+
+    limb_vector result(limbs.size() + limb_shift + 1, 0U);
+
+    if (0U == bit_shift) {
+        std::copy(std::cbegin(limbs), std::cend(limbs), std::begin(result) + limb_shift);
+    } else {
+        limb_type carry{};
+        for (size_t i{}; i < limbs.size(); ++i) {
+            result[i + limb_shift] = (limbs[i] << bit_shift) | carry;
+            carry = limbs[i] >> (limb_bits - bit_shift);
+        }
+        result[limbs.size() + limb_shift] = carry;
+    }
+
+    trim_leading_zero_limbs(result);
+
+    return result;
+}
+
+limb_vector org::atib::numerics::detail::shift_magnitude_right(const limb_vector &limbs, const size_t bit_count) {
+    const size_t limb_shift{bit_count / limb_bits};
+
+    if (limb_shift >= limbs.size())
+        return {};
+
+    const size_t bit_shift{bit_count % limb_bits};
+
+    limb_vector result(limbs.size() - limb_shift, 0U);
+
+    if (0U == bit_shift) {
+        std::copy(std::cbegin(limbs) + limb_shift, std::cend(limbs), std::begin(result));
+    } else {
+        for (size_t i{}; i < result.size(); ++i) {
+            const size_t j{i + limb_shift};
+            result[i] = limbs[j] >> bit_shift;
+            if (j + 1 < limbs.size())
+                result[i] |= limbs[j + 1] << (limb_bits - bit_shift);
+        }
+    }
+
+    trim_leading_zero_limbs(result);
+
+    return result;
+}
+
+size_t org::atib::numerics::detail::get_bit_length(const limb_vector &limbs) noexcept {
+    if (limbs.empty())
+        return 0U;
+
+    return limbs.size() * limb_bits - count_leading_zero_bits(limbs.back());
+}
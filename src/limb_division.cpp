@@ -0,0 +1,152 @@
+#include "../include/limb_arithmetic.h"
+
+#include <algorithm>
+
+using namespace org::atib::numerics;
+using namespace org::atib::numerics::detail;
+
+namespace {
+
+    // limbs[first, first + count) without leading zero limbs
+    limb_vector get_limb_range(const limb_vector &limbs, const size_t first, const size_t count) {
+        if (first >= limbs.size())
+            return {};
+
+        limb_vector range(limbs.cbegin() + first, limbs.cbegin() + std::min(limbs.size(), first + count));
+        trim_leading_zero_limbs(range);
+
+        return range;
+    }
+
+    // high * B^low_size + low, low must be shorter than low_size limbs
+    limb_vector concatenate_limbs(const limb_vector &high, const limb_vector &low, const size_t low_size) {
+        if (high.empty())
+            return low;
+
+        limb_vector result(low_size + high.size(), 0U);
+        std::copy(low.cbegin(), low.cend(), result.begin());
+        std::copy(high.cbegin(), high.cend(), result.begin() + low_size);
+
+        return result;
+    }
+
+    void divide_two_blocks_by_one(const limb_vector &dividend,
+                                  const limb_vector &divisor,
+                                  size_t block_size,
+                                  limb_vector &quotient,
+                                  limb_vector &remainder);
+
+    // Divides dividend < divisor * B^half by the divisor of 2 * half limbs with the most significant bit set.
+    void divide_three_halves_by_two(const limb_vector &dividend,
+                                    const limb_vector &divisor,
+                                    const size_t half,
+                                    limb_vector &quotient,
+                                    limb_vector &remainder) {
+        const limb_vector divisor_high{get_limb_range(divisor, half, half)};
+        const limb_vector divisor_low{get_limb_range(divisor, 0U, half)};
+        const limb_vector dividend_high{get_limb_range(dividend, half, 2 * half)};
+
+        // estimate the quotient from the two high halves of the dividend and the high half of the divisor
+        limb_vector partial_remainder{};
+
+        if (compare_magnitudes(get_limb_range(dividend, 2 * half, half), divisor_high) < 0) {
+            divide_two_blocks_by_one(dividend_high, divisor_high, half, quotient, partial_remainder);
+        } else {
+            quotient.assign(half, max_limb_value);
+            partial_remainder = add_magnitudes(
+                    subtract_magnitudes(dividend_high, concatenate_limbs(divisor_high, {}, half)), divisor_high);
+        }
+
+        remainder = concatenate_limbs(partial_remainder, get_limb_range(dividend, 0U, half), half);
+        const limb_vector correction{multiply_magnitudes(quotient, divisor_low)};
+
+        // the estimate exceeds the quotient by at most two
+        while (compare_magnitudes(remainder, correction) < 0) {
+            remainder = add_magnitudes(remainder, divisor);
+            quotient = subtract_magnitudes(quotient, {1U});
+        }
+
+        remainder = subtract_magnitudes(remainder, correction);
+    }
+
+    // Divides dividend < divisor * B^block_size by the divisor of block_size limbs with the most significant bit set.
+    void divide_two_blocks_by_one(const limb_vector &dividend,
+                                  const limb_vector &divisor,
+                                  const size_t block_size,
+                                  limb_vector &quotient,
+                                  limb_vector &remainder) {
+        if (0U != block_size % 2U || block_size < BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD) {
+            divide_magnitudes_knuth(dividend, divisor, quotient, remainder);
+            return;
+        }
+
+        const size_t half{block_size / 2};
+        limb_vector high_quotient{}, high_remainder{}, low_quotient{};
+
+        divide_three_halves_by_two(get_limb_range(dividend, half, 3 * half), divisor, half, high_quotient,
+                                   high_remainder);
+        divide_three_halves_by_two(concatenate_limbs(high_remainder, get_limb_range(dividend, 0U, half), half),
+                                   divisor, half, low_quotient, remainder);
+
+        quotient = concatenate_limbs(high_quotient, low_quotient, half);
+    }
+
+}// namespace
+
+void org::atib::numerics::detail::divide_magnitudes(const limb_vector &dividend,
+                                                   const limb_vector &divisor,
+                                                   limb_vector &quotient,
+                                                   limb_vector &remainder) {
+    if (divisor.size() >= BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD &&
+        dividend.size() >= divisor.size() + BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD)
+        divide_magnitudes_burnikel_ziegler(dividend, divisor, quotient, remainder);
+    else
+        divide_magnitudes_knuth(dividend, divisor, quotient, remainder);
+}
+
+void org::atib::numerics::detail::divide_magnitudes_burnikel_ziegler(const limb_vector &dividend,
+                                                                    const limb_vector &divisor,
+                                                                    limb_vector &quotient,
+                                                                    limb_vector &remainder) {
+    if (compare_magnitudes(dividend, divisor) < 0) {
+        remainder = dividend;
+        quotient.clear();
+        return;
+    }
+
+    // the block size is a small multiple of a power of two so that it can be halved down to the threshold
+    size_t power_of_two{1};
+    while (power_of_two * BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD <= divisor.size())
+        power_of_two *= 2;
+
+    const size_t block_size{(divisor.size() + power_of_two - 1) / power_of_two * power_of_two};
+    const size_t normalization_shift{
+            (block_size - divisor.size()) * limb_bits + count_leading_zero_bits(divisor.back())
+    };
+
+    const limb_vector normalized_divisor{shift_magnitude_left(divisor, normalization_shift)};
+    const limb_vector normalized_dividend{shift_magnitude_left(dividend, normalization_shift)};
+
+    // the most significant block of the dividend must be less than the divisor
+    const size_t block_count{std::max<size_t>(2U, (get_bit_length(normalized_dividend) + 1 + block_size * limb_bits - 1) /
+                                                  (block_size * limb_bits))};
+
+    limb_vector current_dividend{get_limb_range(normalized_dividend, (block_count - 2) * block_size, 2 * block_size)};
+    limb_vector current_remainder{};
+
+    quotient.assign((block_count - 1) * block_size, 0U);
+
+    for (size_t i{block_count - 1}; i > 0U; --i) {
+        limb_vector block_quotient{};
+        divide_two_blocks_by_one(current_dividend, normalized_divisor, block_size, block_quotient, current_remainder);
+        std::copy(block_quotient.cbegin(), block_quotient.cend(), quotient.begin() + (i - 1) * block_size);
+
+        if (i > 1U)
+            current_dividend = concatenate_limbs(current_remainder,
+                                                 get_limb_range(normalized_dividend, (i - 2) * block_size, block_size),
+                                                 block_size);
+    }
+
+    trim_leading_zero_limbs(quotient);
+    remainder = shift_magnitude_right(current_remainder, normalization_shift);
+}
@@ -0,0 +1,450 @@
+#include "../include/limb_arithmetic.h"
+
+#include <algorithm>
+
+using namespace org::atib::numerics;
+using namespace org::atib::numerics::detail;
+
+namespace {
+
+    // Stores |lhs - rhs| into result (lhs_size limbs, lhs_size >= rhs_size) and returns true if rhs > lhs.
+    bool subtract_limb_sequences_absolute(limb_type *result,
+                                          const limb_type *lhs,
+                                          const size_t lhs_size,
+                                          const limb_type *rhs,
+                                          const size_t rhs_size) noexcept {
+        const size_t normalized_lhs_size{get_normalized_size(lhs, lhs_size)};
+        const size_t normalized_rhs_size{get_normalized_size(rhs, rhs_size)};
+
+        const bool is_rhs_greater{
+                normalized_lhs_size != normalized_rhs_size
+                ? normalized_lhs_size < normalized_rhs_size
+                : compare_limb_sequences(lhs, rhs, normalized_lhs_size) < 0
+        };
+
+        if (is_rhs_greater) {
+            subtract_limb_sequences(result, rhs, normalized_rhs_size, lhs, normalized_lhs_size);
+            std::fill(result + normalized_rhs_size, result + lhs_size, limb_type{});
+        } else {
+            subtract_limb_sequences(result, lhs, lhs_size, rhs, rhs_size);
+        }
+
+        return is_rhs_greater;
+    }
+
+    // Multiplies a long lhs by a much shorter rhs one rhs_size sized block of lhs at a time.
+    void multiply_unbalanced_limb_sequences(limb_type *result,
+                                            const limb_type *lhs,
+                                            const size_t lhs_size,
+                                            const limb_type *rhs,
+                                            const size_t rhs_size) {
+        limb_vector block_product(2 * rhs_size);
+
+        std::fill(result, result + lhs_size + rhs_size, limb_type{});
+
+        // the limbs from offset + rhs_size on are still zero, so the carry of a block stops one limb after its product
+        for (size_t offset{}; offset < lhs_size; offset += rhs_size) {
+            const size_t block_size{std::min(rhs_size, lhs_size - offset)};
+            const size_t sum_size{std::min(lhs_size + rhs_size - offset, block_size + rhs_size + 1)};
+            multiply_limb_sequences(block_product.data(), lhs + offset, block_size, rhs, rhs_size);
+            add_limb_sequences(result + offset, result + offset, sum_size, block_product.data(), block_size + rhs_size);
+        }
+    }
+
+    struct limb_sequence_view {
+        const limb_type *data;
+        size_t size;
+    };
+
+    // Values of the evaluated Toom-Cook polynomials at negative points may be negative.
+    struct signed_magnitude {
+        limb_vector magnitude;
+        bool is_negative;
+    };
+
+    // accumulator += limbs * multiplier
+    void add_multiple_in_place(limb_vector &accumulator, const limb_type *limbs, size_t size, const limb_type multiplier) {
+        size = get_normalized_size(limbs, size);
+
+        if (accumulator.size() <= size)
+            accumulator.resize(size + 1, 0U);
+
+        limb_type carry{1U == multiplier ? add_limb_sequences(accumulator.data(), accumulator.data(), size, limbs, size)
+                                         : multiply_add_limb_sequence_by_limb(accumulator.data(), limbs, size, multiplier)};
+
+        for (size_t i{size}; 0U != carry && i < accumulator.size(); ++i) {
+            accumulator[i] += carry;
+            carry = static_cast<limb_type>(accumulator[i] < carry);
+        }
+
+        if (0U != carry)
+            accumulator.push_back(carry);
+
+        trim_leading_zero_limbs(accumulator);
+    }
+
+    void add_multiple_in_place(limb_vector &accumulator, const limb_vector &limbs, const limb_type multiplier = 1U) {
+        add_multiple_in_place(accumulator, limbs.data(), limbs.size(), multiplier);
+    }
+
+    // accumulator -= limbs * multiplier, the difference must not be negative
+    void subtract_multiple_in_place(limb_vector &accumulator, const limb_vector &limbs, const limb_type multiplier = 1U) {
+        const size_t size{limbs.size()};
+
+        limb_type borrow{
+                1U == multiplier ? subtract_limb_sequences(accumulator.data(), accumulator.data(), size, limbs.data(), size)
+                                 : multiply_subtract_limb_sequence_by_limb(accumulator.data(), limbs.data(), size,
+                                                                           multiplier)
+        };
+
+        for (size_t i{size}; 0U != borrow && i < accumulator.size(); ++i) {
+            const limb_type value{accumulator[i]};
+            accumulator[i] = value - borrow;
+            borrow = static_cast<limb_type>(value < borrow);
+        }
+
+        trim_leading_zero_limbs(accumulator);
+    }
+
+    void shift_right_in_place(limb_vector &limbs, const size_t bit_count) noexcept {
+        for (size_t i{}; i < limbs.size(); ++i) {
+            limbs[i] >>= bit_count;
+            if (i + 1 < limbs.size())
+                limbs[i] |= limbs[i + 1] << (limb_bits - bit_count);
+        }
+
+        trim_leading_zero_limbs(limbs);
+    }
+
+    // lhs + rhs and lhs - rhs of two non-negative values
+    void add_and_subtract_magnitudes(const limb_vector &lhs,
+                                     const limb_vector &rhs,
+                                     signed_magnitude &sum,
+                                     signed_magnitude &difference) {
+        sum = {lhs, false};
+        add_multiple_in_place(sum.magnitude, rhs);
+
+        const bool is_rhs_greater{compare_magnitudes(lhs, rhs) < 0};
+        difference = {is_rhs_greater ? rhs : lhs, is_rhs_greater};
+        subtract_multiple_in_place(difference.magnitude, is_rhs_greater ? lhs : rhs);
+    }
+
+    // Recovers the sums of the even and of the odd coefficients, (value(p) + value(-p)) / 2 and
+    // (value(p) - value(-p)) / (2 p) for p = 2^odd_shift, from the values at p and -p.
+    void separate_even_and_odd_coefficient_sums(const limb_vector &positive_point_value,
+                                                const signed_magnitude &negative_point_value,
+                                                const size_t odd_shift,
+                                                limb_vector &even_sum,
+                                                limb_vector &odd_sum) {
+        even_sum = positive_point_value;
+        odd_sum = positive_point_value;
+
+        if (negative_point_value.is_negative) {
+            subtract_multiple_in_place(even_sum, negative_point_value.magnitude);
+            add_multiple_in_place(odd_sum, negative_point_value.magnitude);
+        } else {
+            add_multiple_in_place(even_sum, negative_point_value.magnitude);
+            subtract_multiple_in_place(odd_sum, negative_point_value.magnitude);
+        }
+
+        shift_right_in_place(even_sum, 1U);
+        shift_right_in_place(odd_sum, 1U + odd_shift);
+    }
+
+    limb_vector multiply_limb_sequence_views(const limb_sequence_view &lhs, const limb_sequence_view &rhs) {
+        if (0U == lhs.size || 0U == rhs.size)
+            return {};
+
+        limb_vector product(lhs.size + rhs.size);
+        multiply_limb_sequences(product.data(), lhs.data, lhs.size, rhs.data, rhs.size);
+        trim_leading_zero_limbs(product);
+
+        return product;
+    }
+
+    signed_magnitude multiply_signed_magnitudes(const signed_magnitude &lhs, const signed_magnitude &rhs) {
+        limb_vector product{
+                multiply_limb_sequence_views({lhs.magnitude.data(), lhs.magnitude.size()},
+                                             {rhs.magnitude.data(), rhs.magnitude.size()})
+        };
+        const bool is_negative{lhs.is_negative != rhs.is_negative && !product.empty()};
+
+        return {std::move(product), is_negative};
+    }
+
+    // Splits limbs into piece_count pieces of piece_size limbs, the last pieces may be shorter or empty.
+    std::vector<limb_sequence_view> split_limb_sequence(const limb_type *limbs,
+                                                        const size_t size,
+                                                        const size_t piece_count,
+                                                        const size_t piece_size) {
+        std::vector<limb_sequence_view> pieces(piece_count, limb_sequence_view{limbs, 0U});
+
+        for (size_t i{}, offset{}; i < piece_count && offset < size; ++i, offset += piece_size)
+            pieces[i] = {limbs + offset, get_normalized_size(limbs + offset, std::min(piece_size, size - offset))};
+
+        return pieces;
+    }
+
+    // Evaluates the polynomial with the given coefficients at point and -point, or only at point if negative_value
+    // is null.
+    void evaluate_toom_polynomial(const std::vector<limb_sequence_view> &coefficients,
+                                  const limb_type point,
+                                  signed_magnitude &positive_value,
+                                  signed_magnitude *negative_value) {
+        limb_vector even_part{}, odd_part{};
+        limb_type power{1U};
+
+        for (size_t i{}; i < coefficients.size(); ++i, power *= point)
+            add_multiple_in_place(i % 2U == 0U ? even_part : odd_part, coefficients[i].data, coefficients[i].size,
+                                  power);
+
+        if (nullptr != negative_value) {
+            add_and_subtract_magnitudes(even_part, odd_part, positive_value, *negative_value);
+        } else {
+            add_multiple_in_place(even_part, odd_part);
+            positive_value = {std::move(even_part), false};
+        }
+    }
+
+    // Values at 1, -1, 2, (-2, 3), the points in parentheses are only used by Toom-4. The values at 0 and infinity
+    // are the first and the last coefficient and are left empty.
+    std::vector<signed_magnitude> evaluate_toom_polynomial_at_points(const std::vector<limb_sequence_view> &coefficients) {
+        std::vector<signed_magnitude> values(2 * coefficients.size() - 1);
+        evaluate_toom_polynomial(coefficients, 1U, values[1], &values[2]);
+
+        if (3U == coefficients.size()) {
+            evaluate_toom_polynomial(coefficients, 2U, values[3], nullptr);
+        } else {
+            evaluate_toom_polynomial(coefficients, 2U, values[3], &values[4]);
+            evaluate_toom_polynomial(coefficients, 3U, values[5], nullptr);
+        }
+
+        return values;
+    }
+
+    // Products of the lhs and rhs polynomials at 0, 1, -1, 2, (-2, 3) and infinity, the points in parentheses are
+    // only used by Toom-4.
+    std::vector<signed_magnitude> multiply_toom_polynomials(const limb_type *lhs,
+                                                            const size_t lhs_size,
+                                                            const limb_type *rhs,
+                                                            const size_t rhs_size,
+                                                            const size_t piece_count,
+                                                            const size_t piece_size) {
+        const bool is_square{lhs == rhs};
+        const std::vector<limb_sequence_view> lhs_pieces{split_limb_sequence(lhs, lhs_size, piece_count, piece_size)};
+        const std::vector<limb_sequence_view> rhs_pieces{
+                is_square ? lhs_pieces : split_limb_sequence(rhs, rhs_size, piece_count, piece_size)
+        };
+        const size_t point_count{2 * piece_count - 1};
+
+        const std::vector<signed_magnitude> lhs_values{evaluate_toom_polynomial_at_points(lhs_pieces)};
+        const std::vector<signed_magnitude> rhs_values{
+                is_square ? std::vector<signed_magnitude>{} : evaluate_toom_polynomial_at_points(rhs_pieces)
+        };
+
+        std::vector<signed_magnitude> products(point_count);
+        products.front() = {multiply_limb_sequence_views(lhs_pieces.front(), rhs_pieces.front()), false};
+        products.back() = {multiply_limb_sequence_views(lhs_pieces.back(), rhs_pieces.back()), false};
+
+        for (size_t i{1}; i + 1 < point_count; ++i)
+            products[i] = multiply_signed_magnitudes(lhs_values[i], is_square ? lhs_values[i] : rhs_values[i]);
+
+        return products;
+    }
+
+    void accumulate_toom_coefficients(limb_type *result,
+                                      const size_t result_size,
+                                      const std::vector<const limb_vector *> &coefficients,
+                                      const size_t piece_size) {
+        std::fill(result, result + result_size, limb_type{});
+
+        for (size_t i{}; i < coefficients.size(); ++i) {
+            const size_t offset{i * piece_size};
+            if (offset >= result_size)
+                break;
+            add_limb_sequences(result + offset, result + offset, result_size - offset, coefficients[i]->data(),
+                               std::min(coefficients[i]->size(), result_size - offset));
+        }
+    }
+
+}// namespace
+
+void org::atib::numerics::detail::multiply_limb_sequences(limb_type *result,
+                                                          const limb_type *lhs,
+                                                          size_t lhs_size,
+                                                          const limb_type *rhs,
+                                                          size_t rhs_size) {
+    if (lhs_size < rhs_size) {
+        std::swap(lhs, rhs);
+        std::swap(lhs_size, rhs_size);
+    }
+
+    if (0U == rhs_size) {
+        std::fill(result, result + lhs_size, limb_type{});
+        return;
+    }
+
+    if (lhs == rhs && lhs_size == rhs_size) {
+        square_limb_sequence(result, lhs, lhs_size);
+        return;
+    }
+
+    if (rhs_size < BIG_INTEGER_KARATSUBA_THRESHOLD) {
+        multiply_limb_sequences_schoolbook(result, lhs, lhs_size, rhs, rhs_size);
+        return;
+    }
+
+    if (rhs_size >= BIG_INTEGER_NTT_THRESHOLD) {
+        multiply_limb_sequences_ntt(result, lhs, lhs_size, rhs, rhs_size);
+        return;
+    }
+
+    if (2 * rhs_size <= lhs_size + 1) {
+        multiply_unbalanced_limb_sequences(result, lhs, lhs_size, rhs, rhs_size);
+        return;
+    }
+
+    if (rhs_size < BIG_INTEGER_TOOM3_THRESHOLD)
+        multiply_limb_sequences_karatsuba(result, lhs, lhs_size, rhs, rhs_size);
+    else if (rhs_size < BIG_INTEGER_TOOM4_THRESHOLD)
+        multiply_limb_sequences_toom3(result, lhs, lhs_size, rhs, rhs_size);
+    else
+        multiply_limb_sequences_toom4(result, lhs, lhs_size, rhs, rhs_size);
+}
+
+void org::atib::numerics::detail::square_limb_sequence(limb_type *result, const limb_type *limbs, const size_t size) {
+    if (size < BIG_INTEGER_KARATSUBA_SQUARE_THRESHOLD)
+        square_limb_sequence_schoolbook(result, limbs, size);
+    else if (size < BIG_INTEGER_TOOM3_THRESHOLD)
+        multiply_limb_sequences_karatsuba(result, limbs, size, limbs, size);
+    else if (size < BIG_INTEGER_TOOM4_THRESHOLD)
+        multiply_limb_sequences_toom3(result, limbs, size, limbs, size);
+    else if (size < BIG_INTEGER_NTT_THRESHOLD)
+        multiply_limb_sequences_toom4(result, limbs, size, limbs, size);
+    else
+        multiply_limb_sequences_ntt(result, limbs, size, limbs, size);
+}
+
+void org::atib::numerics::detail::multiply_limb_sequences_karatsuba(limb_type *result,
+                                                                    const limb_type *lhs,
+                                                                    const size_t lhs_size,
+                                                                    const limb_type *rhs,
+                                                                    const size_t rhs_size) {
+    // lhs = lhs_high * B^half + lhs_low, rhs = rhs_high * B^half + rhs_low, lhs_size >= rhs_size > half
+    const size_t half{(lhs_size + 1) / 2};
+    const size_t lhs_high_size{lhs_size - half};
+    const size_t rhs_high_size{rhs_size - half};
+    const size_t result_size{lhs_size + rhs_size};
+
+    multiply_limb_sequences(result, lhs, half, rhs, half);
+    multiply_limb_sequences(result + 2 * half, lhs + half, lhs_high_size, rhs + half, rhs_high_size);
+
+    // (lhs_low - lhs_high) * (rhs_high - rhs_low) = middle - low_product - high_product, when squaring it is
+    // -(lhs_low - lhs_high)^2
+    const bool is_square{lhs == rhs};
+    limb_vector lhs_difference(half), rhs_difference(is_square ? 0U : half);
+    const bool is_lhs_difference_negative{
+            subtract_limb_sequences_absolute(lhs_difference.data(), lhs, half, lhs + half, lhs_high_size)
+    };
+    const bool is_rhs_difference_negative{
+            is_square ? !is_lhs_difference_negative
+                      : !subtract_limb_sequences_absolute(rhs_difference.data(), rhs, half, rhs + half, rhs_high_size)
+    };
+
+    limb_vector middle(2 * half + 1);
+    multiply_limb_sequences(middle.data(), lhs_difference.data(), half,
+                            is_square ? lhs_difference.data() : rhs_difference.data(), half);
+
+    limb_vector outer_sum(2 * half + 1);
+    outer_sum[2 * half] = add_limb_sequences(outer_sum.data(), result, 2 * half, result + 2 * half,
+                                             result_size - 2 * half);
+
+    if (is_lhs_difference_negative == is_rhs_difference_negative)
+        add_limb_sequences(middle.data(), outer_sum.data(), outer_sum.size(), middle.data(), 2 * half);
+    else
+        subtract_limb_sequences(middle.data(), outer_sum.data(), outer_sum.size(), middle.data(), 2 * half);
+
+    add_limb_sequences(result + half, result + half, result_size - half, middle.data(),
+                       std::min(middle.size(), result_size - half));
+}
+
+void org::atib::numerics::detail::multiply_limb_sequences_toom3(limb_type *result,
+                                                                const limb_type *lhs,
+                                                                const size_t lhs_size,
+                                                                const limb_type *rhs,
+                                                                const size_t rhs_size) {
+    const size_t piece_size{(lhs_size + 2) / 3};
+    std::vector<signed_magnitude> values{multiply_toom_polynomials(lhs, lhs_size, rhs, rhs_size, 3U, piece_size)};
+
+    // values at 0, 1, -1, 2 and infinity of c0 + c1 x + c2 x^2 + c3 x^3 + c4 x^4
+    const limb_vector &c0{values[0].magnitude};
+    const limb_vector &c4{values[4].magnitude};
+
+    limb_vector c2{}, c1{};
+    separate_even_and_odd_coefficient_sums(values[1].magnitude, values[2], 0U, c2, c1);
+    subtract_multiple_in_place(c2, c0);
+    subtract_multiple_in_place(c2, c4);
+
+    // (value at 2 - c0 - 4 c2 - 16 c4) / 2 - (c1 + c3) = 3 c3
+    limb_vector &c3{values[3].magnitude};
+    subtract_multiple_in_place(c3, c0);
+    subtract_multiple_in_place(c3, c2, 4U);
+    subtract_multiple_in_place(c3, c4, 16U);
+    shift_right_in_place(c3, 1U);
+    subtract_multiple_in_place(c3, c1);
+    divide_magnitude_by_limb(c3, 3U);
+    subtract_multiple_in_place(c1, c3);
+
+    accumulate_toom_coefficients(result, lhs_size + rhs_size, {&c0, &c1, &c2, &c3, &c4}, piece_size);
+}
+
+void org::atib::numerics::detail::multiply_limb_sequences_toom4(limb_type *result,
+                                                                const limb_type *lhs,
+                                                                const size_t lhs_size,
+                                                                const limb_type *rhs,
+                                                                const size_t rhs_size) {
+    const size_t piece_size{(lhs_size + 3) / 4};
+    std::vector<signed_magnitude> values{multiply_toom_polynomials(lhs, lhs_size, rhs, rhs_size, 4U, piece_size)};
+
+    // values at 0, 1, -1, 2, -2, 3 and infinity of c0 + c1 x + ... + c6 x^6
+    const limb_vector &c0{values[0].magnitude};
+    const limb_vector &c6{values[6].magnitude};
+
+    // c2 + c4 and c1 + c3 + c5
+    limb_vector c2{}, c1{};
+    separate_even_and_odd_coefficient_sums(values[1].magnitude, values[2], 0U, c2, c1);
+    subtract_multiple_in_place(c2, c0);
+    subtract_multiple_in_place(c2, c6);
+
+    // 4 c2 + 16 c4 and c1 + 4 c3 + 16 c5
+    limb_vector c4{}, c3{};
+    separate_even_and_odd_coefficient_sums(values[3].magnitude, values[4], 1U, c4, c3);
+    subtract_multiple_in_place(c4, c0);
+    subtract_multiple_in_place(c4, c6, 64U);
+
+    subtract_multiple_in_place(c4, c2, 4U);
+    divide_magnitude_by_limb(c4, 12U);
+    subtract_multiple_in_place(c2, c4);
+
+    // (value at 3 - c0 - 9 c2 - 81 c4 - 729 c6) / 3 = c1 + 9 c3 + 81 c5
+    limb_vector &c5{values[5].magnitude};
+    subtract_multiple_in_place(c5, c0);
+    subtract_multiple_in_place(c5, c2, 9U);
+    subtract_multiple_in_place(c5, c4, 81U);
+    subtract_multiple_in_place(c5, c6, 729U);
+    divide_magnitude_by_limb(c5, 3U);
+
+    // c3 + 5 c5 and c3 + 10 c5
+    subtract_multiple_in_place(c3, c1);
+    divide_magnitude_by_limb(c3, 3U);
+    subtract_multiple_in_place(c5, c1);
+    shift_right_in_place(c5, 3U);
+
+    subtract_multiple_in_place(c5, c3);
+    divide_magnitude_by_limb(c5, 5U);
+    subtract_multiple_in_place(c3, c5, 5U);
+    subtract_multiple_in_place(c1, c3);
+    subtract_multiple_in_place(c1, c5);
+
+    accumulate_toom_coefficients(result, lhs_size + rhs_size, {&c0, &c1, &c2, &c3, &c4, &c5, &c6}, piece_size);
+}
@@ -0,0 +1,696 @@
+#include "../include/modular_arithmetic.h"
+
+#include "../include/number_theory.h"
+
+using namespace org::atib::numerics;
+
+namespace {
+
+    using limb_type = detail::limb_type;
+
+    // Product without the partial products of the columns below skipped_size, which it undercuts by less than
+    // skipped_size * B^(skipped_size + 1). result must hold lhs_size + rhs_size limbs.
+    void multiply_limb_sequences_high(limb_type *result,
+                                      const limb_type *lhs,
+                                      const size_t lhs_size,
+                                      const limb_type *rhs,
+                                      const size_t rhs_size,
+                                      const size_t skipped_size) {
+        if (lhs_size >= BIG_INTEGER_KARATSUBA_THRESHOLD && rhs_size >= BIG_INTEGER_KARATSUBA_THRESHOLD) {
+            detail::multiply_limb_sequences(result, lhs, lhs_size, rhs, rhs_size);
+            return;
+        }
+
+        std::fill(result, result + lhs_size + rhs_size, 0U);
+        for (size_t i{}; i < lhs_size; ++i) {
+            const size_t first{skipped_size > i ? std::min(skipped_size - i, rhs_size) : 0U};
+            result[i + rhs_size] = detail::multiply_add_limb_sequence_by_limb(result + i + first, rhs + first,
+                                                                              rhs_size - first, lhs[i]);
+        }
+    }
+
+    // The lowest size limbs of the product, result must hold size limbs.
+    void multiply_limb_sequences_low(limb_type *result,
+                                     const limb_type *lhs,
+                                     const size_t lhs_size,
+                                     const limb_type *rhs,
+                                     const size_t rhs_size,
+                                     const size_t size) {
+        std::fill(result, result + size, 0U);
+        if (0U == lhs_size || 0U == rhs_size)
+            return;
+
+        if (lhs_size >= BIG_INTEGER_KARATSUBA_THRESHOLD && rhs_size >= BIG_INTEGER_KARATSUBA_THRESHOLD) {
+            std::vector<limb_type> product(lhs_size + rhs_size);
+            detail::multiply_limb_sequences(product.data(), lhs, lhs_size, rhs, rhs_size);
+            std::copy(product.cbegin(), product.cbegin() + std::min(size, product.size()), result);
+            return;
+        }
+
+        for (size_t i{}; i < std::min(lhs_size, size); ++i) {
+            const size_t length{std::min(rhs_size, size - i)};
+            const limb_type carry{detail::multiply_add_limb_sequence_by_limb(result + i, rhs, length, lhs[i])};
+            if (i + length < size)
+                result[i + length] = carry;
+        }
+    }
+
+    bool is_bit_set(const std::vector<limb_type> &limbs, const size_t index) noexcept {
+        return ((limbs[index / detail::limb_bits] >> (index % detail::limb_bits)) & 1U) != 0U;
+    }
+
+    // bits [first, first + count) of limbs, count must not exceed limb_bits
+    limb_type get_bits(const std::vector<limb_type> &limbs, const size_t first, const size_t count) noexcept {
+        limb_type bits{};
+        for (size_t i{first + count}; i > first; --i)
+            bits = (bits << 1U) | static_cast<limb_type>(i - 1 < limbs.size() * detail::limb_bits &&
+                                                         is_bit_set(limbs, i - 1));
+        return bits;
+    }
+
+    // the window sizes minimizing the number of multiplications for exponents of these lengths
+    size_t get_window_bit_count(const size_t exponent_bit_count) noexcept {
+        if (exponent_bit_count > 671U)
+            return 6U;
+        if (exponent_bit_count > 239U)
+            return 5U;
+        if (exponent_bit_count > 79U)
+            return 4U;
+        return exponent_bit_count > 23U ? 3U : 1U;
+    }
+
+    // base^exponent for a positive exponent with the multiply(target, factor) and square(target) operations of a
+    // modular context, scanning the exponent from the top in windows that start and end with a one bit
+    template<typename MultiplyFunction, typename SquareFunction>
+    std::vector<limb_type> raise_by_sliding_window(const std::vector<limb_type> &base,
+                                                   const std::vector<limb_type> &exponent,
+                                                   MultiplyFunction multiply,
+                                                   SquareFunction square) {
+        const size_t bit_count{detail::get_bit_length(exponent)};
+        const size_t window_bit_count{get_window_bit_count(bit_count)};
+
+        // base, base^3, ..., base^(2^window_bit_count - 1)
+        std::vector<std::vector<limb_type>> odd_powers(size_t{1} << (window_bit_count - 1));
+        odd_powers.front() = base;
+        if (odd_powers.size() > 1U) {
+            std::vector<limb_type> base_squared{base};
+            square(base_squared);
+
+            for (size_t i{1}; i < odd_powers.size(); ++i) {
+                odd_powers[i] = odd_powers[i - 1];
+                multiply(odd_powers[i], base_squared);
+            }
+        }
+
+        std::vector<limb_type> result{};
+        for (size_t end{bit_count}; end > 0U;) {
+            if (!is_bit_set(exponent, end - 1)) {
+                square(result);
+                --end;
+                continue;
+            }
+
+            size_t start{end > window_bit_count ? end - window_bit_count : 0U};
+            while (!is_bit_set(exponent, start))
+                ++start;
+
+            const std::vector<limb_type> &window_power{odd_powers[get_bits(exponent, start, end - start) >> 1U]};
+            if (end == bit_count) {
+                result = window_power;
+            } else {
+                for (size_t i{start}; i < end; ++i)
+                    square(result);
+                multiply(result, window_power);
+            }
+
+            end = start;
+        }
+
+        return result;
+    }
+
+}// namespace
+
+barrett_context::barrett_context(const big_integer &modulus) : modulus_{modulus.abs()} {
+    if (modulus_.is_nan() || modulus_.is_zero()) {
+#ifndef BIG_INTEGER_NO_THROW
+        if (modulus_.is_zero())
+            throw division_by_zero_error{};
+#endif
+        modulus_ = big_integer::nan;
+        return;
+    }
+
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+    std::vector<limb_type> power(2 * modulus_limbs.size() + 1, 0U), remainder{};
+    power.back() = 1U;
+    detail::divide_magnitudes(power, modulus_limbs, inverse_, remainder);
+}
+
+const big_integer &barrett_context::get_modulus() const noexcept {
+    return modulus_;
+}
+
+big_integer barrett_context::reduce(const big_integer &number) const {
+    if (number.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    std::vector<limb_type> magnitude{number.get_limbs()};
+    reduce_magnitude(magnitude);
+
+    return make_result(std::move(magnitude), number.is_negative_number());
+}
+
+big_integer barrett_context::mul_mod(const big_integer &lhs, const big_integer &rhs) const {
+    if (lhs.is_nan() || rhs.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    std::vector<limb_type> product{detail::multiply_magnitudes(lhs.get_limbs(), rhs.get_limbs())};
+    reduce_magnitude(product);
+
+    return make_result(std::move(product), lhs.is_negative_number() != rhs.is_negative_number());
+}
+
+big_integer barrett_context::add_mod(const big_integer &lhs, const big_integer &rhs) const {
+    if (lhs.is_nan() || rhs.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    const std::vector<limb_type> &lhs_limbs{lhs.get_limbs()};
+    const std::vector<limb_type> &rhs_limbs{rhs.get_limbs()};
+    std::vector<limb_type> sum{};
+    bool is_negative_sum{lhs.is_negative_number()};
+
+    if (lhs.is_negative_number() == rhs.is_negative_number()) {
+        sum = detail::add_magnitudes(lhs_limbs, rhs_limbs);
+    } else if (detail::compare_magnitudes(lhs_limbs, rhs_limbs) >= 0) {
+        sum = detail::subtract_magnitudes(lhs_limbs, rhs_limbs);
+    } else {
+        sum = detail::subtract_magnitudes(rhs_limbs, lhs_limbs);
+        is_negative_sum = rhs.is_negative_number();
+    }
+
+    // the sum of two reduced operands needs at most one subtraction of the modulus
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+    if (detail::compare_magnitudes(sum, modulus_limbs) >= 0)
+        sum = detail::subtract_magnitudes(sum, modulus_limbs);
+    reduce_magnitude(sum);
+
+    return make_result(std::move(sum), is_negative_sum);
+}
+
+big_integer barrett_context::make_result(std::vector<limb_type> magnitude, const bool is_negative_number) const {
+    if (is_negative_number && !magnitude.empty())
+        magnitude = detail::subtract_magnitudes(modulus_.get_limbs(), magnitude);
+
+    return big_integer::from_limbs(std::move(magnitude));
+}
+
+void barrett_context::reduce_magnitude(std::vector<limb_type> &magnitude) const {
+    const size_t modulus_size{modulus_.get_limbs().size()};
+
+    if (magnitude.size() <= 2 * modulus_size) {
+        reduce_short_magnitude(magnitude);
+        return;
+    }
+
+    // longer numbers are reduced modulus_size limbs at a time from the top, every block being the previous
+    // remainder followed by the next limbs and therefore shorter than 2 * modulus_size limbs
+    std::vector<limb_type> remainder{};
+
+    for (size_t offset{(magnitude.size() + modulus_size - 1) / modulus_size * modulus_size}; offset > 0U;) {
+        offset -= modulus_size;
+
+        std::vector<limb_type> block(modulus_size + remainder.size(), 0U);
+        std::copy(magnitude.cbegin() + offset,
+                  magnitude.cbegin() + std::min(magnitude.size(), offset + modulus_size),
+                  block.begin());
+        std::copy(remainder.cbegin(), remainder.cend(), block.begin() + modulus_size);
+        detail::trim_leading_zero_limbs(block);
+
+        reduce_short_magnitude(block);
+        remainder = std::move(block);
+    }
+
+    magnitude = std::move(remainder);
+}
+
+void barrett_context::reduce_short_magnitude(std::vector<limb_type> &magnitude) const {
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+    const size_t modulus_size{modulus_limbs.size()};
+
+    if (detail::compare_magnitudes(magnitude, modulus_limbs) < 0)
+        return;
+
+    // floor(floor(x / B^(n - 1)) * inverse / B^(n + 1)) is at most two less than floor(x / modulus), leaving out the
+    // partial products below B^(n - 1) costs at most one more
+    const limb_type *magnitude_high{magnitude.data() + (modulus_size - 1)};
+    const size_t magnitude_high_size{magnitude.size() - (modulus_size - 1)};
+    std::vector<limb_type> product(magnitude_high_size + inverse_.size(), 0U);
+    multiply_limb_sequences_high(product.data(), magnitude_high, magnitude_high_size,
+                                 inverse_.data(), inverse_.size(), modulus_size - 1);
+
+    const limb_type *quotient{product.data() + (modulus_size + 1)};
+    const size_t quotient_size{detail::get_normalized_size(quotient, product.size() - (modulus_size + 1))};
+
+    // x - quotient * modulus is less than 4 * modulus, so it is computed modulo B^(n + 1)
+    std::vector<limb_type> multiple(modulus_size + 1, 0U);
+    multiply_limb_sequences_low(multiple.data(), quotient, quotient_size,
+                                modulus_limbs.data(), modulus_size, modulus_size + 1);
+
+    magnitude.resize(modulus_size + 1, 0U);
+    detail::subtract_limb_sequences(magnitude.data(), magnitude.data(), magnitude.size(),
+                                    multiple.data(), multiple.size());
+    detail::trim_leading_zero_limbs(magnitude);
+
+    while (detail::compare_magnitudes(magnitude, modulus_limbs) >= 0) {
+        detail::subtract_limb_sequences(magnitude.data(), magnitude.data(), magnitude.size(),
+                                        modulus_limbs.data(), modulus_limbs.size());
+        detail::trim_leading_zero_limbs(magnitude);
+    }
+}
+
+montgomery_context::montgomery_context(const big_integer &modulus) : modulus_{modulus.abs()} {
+    if (modulus_.is_nan() || modulus_.is_zero() || (modulus_.get_limbs().front() & 1U) == 0U) {
+#ifndef BIG_INTEGER_NO_THROW
+        if (modulus_.is_zero())
+            throw division_by_zero_error{};
+        if (!modulus_.is_nan())
+            throw std::invalid_argument{"Montgomery arithmetic requires an odd modulus!"};
+#endif
+        modulus_ = big_integer::nan;
+        return;
+    }
+
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+
+    // every Newton step x * (2 - m * x) doubles the number of correct low bits, starting with 3 for odd m
+    limb_type inverse{modulus_limbs.front()};
+    for (size_t i{}; i < 5U; ++i)
+        inverse *= 2U - modulus_limbs.front() * inverse;
+    negated_inverse_ = 0U - inverse;
+
+    // long moduli are reduced by multiplications with -m^-1 mod R, lifted from the limb inverse in the same way
+    if (modulus_limbs.size() >= BIG_INTEGER_MONTGOMERY_REDC_THRESHOLD) {
+        const size_t bit_count{modulus_limbs.size() * detail::limb_bits};
+        const big_integer power{big_integer::plus_one << bit_count}, mask{power - big_integer::plus_one};
+        const big_integer two_plus_power{power + big_integer{2}};
+        big_integer lifted_inverse{inverse};
+
+        for (size_t precision{detail::limb_bits}; precision < bit_count; precision *= 2)
+            lifted_inverse = (lifted_inverse * (two_plus_power - ((modulus_ * lifted_inverse) & mask))) & mask;
+
+        negated_inverse_limbs_ = (power - lifted_inverse).get_limbs();
+        negated_inverse_limbs_.resize(modulus_limbs.size(), 0U);
+    }
+
+    std::vector<limb_type> power(2 * modulus_limbs.size() + 1, 0U), quotient{};
+    power.back() = 1U;
+    detail::divide_magnitudes(power, modulus_limbs, quotient, r_squared_);
+    r_squared_.resize(modulus_limbs.size(), 0U);
+}
+
+const big_integer &montgomery_context::get_modulus() const noexcept {
+    return modulus_;
+}
+
+big_integer montgomery_context::to_montgomery(const big_integer &number) const {
+    if (number.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    return big_integer::from_limbs(get_montgomery_form_limbs(number));
+}
+
+big_integer montgomery_context::from_montgomery(const big_integer &number) const {
+    if (number.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    std::vector<limb_type> limbs{get_reduced_limbs(number)};
+    limbs.resize(2 * limbs.size(), 0U);
+    reduce_limbs(limbs.data(), limbs.data());
+    limbs.resize(limbs.size() / 2);
+
+    return big_integer::from_limbs(std::move(limbs));
+}
+
+big_integer montgomery_context::mul(const big_integer &lhs, const big_integer &rhs) const {
+    if (lhs.is_nan() || rhs.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    std::vector<limb_type> lhs_limbs{get_reduced_limbs(lhs)};
+    const std::vector<limb_type> rhs_limbs{get_reduced_limbs(rhs)};
+    multiply_limbs(lhs_limbs.data(), lhs_limbs.data(), rhs_limbs.data());
+
+    return big_integer::from_limbs(std::move(lhs_limbs));
+}
+
+big_integer montgomery_context::square(const big_integer &number) const {
+    if (number.is_nan() || modulus_.is_nan())
+        return big_integer::nan;
+
+    std::vector<limb_type> limbs{get_reduced_limbs(number)};
+    square_limbs(limbs.data(), limbs.data());
+
+    return big_integer::from_limbs(std::move(limbs));
+}
+
+std::vector<montgomery_context::limb_type> montgomery_context::get_reduced_limbs(const big_integer &number) const {
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+    std::vector<limb_type> limbs{number.get_limbs()};
+
+    if (number.is_negative_number() || detail::compare_magnitudes(limbs, modulus_limbs) >= 0) {
+        std::vector<limb_type> quotient{}, remainder{};
+        detail::divide_magnitudes(limbs, modulus_limbs, quotient, remainder);
+
+        limbs = number.is_negative_number() && !remainder.empty()
+                ? detail::subtract_magnitudes(modulus_limbs, remainder)
+                : std::move(remainder);
+    }
+
+    limbs.resize(modulus_limbs.size(), 0U);
+    return limbs;
+}
+
+std::vector<montgomery_context::limb_type> montgomery_context::get_montgomery_form_limbs(
+        const big_integer &number) const {
+    std::vector<limb_type> limbs{get_reduced_limbs(number)};
+    multiply_limbs(limbs.data(), limbs.data(), r_squared_.data());
+
+    return limbs;
+}
+
+void montgomery_context::multiply_limbs(limb_type *result, const limb_type *lhs, const limb_type *rhs) const {
+    const size_t size{modulus_.get_limbs().size()};
+
+    if (size >= BIG_INTEGER_KARATSUBA_THRESHOLD) {
+        std::vector<limb_type> product(2 * size);
+        detail::multiply_limb_sequences(product.data(), lhs, size, rhs, size);
+        reduce_limbs(result, product.data());
+        return;
+    }
+
+    multiply_limbs_interleaved(result, lhs, rhs);
+}
+
+void montgomery_context::multiply_limbs_interleaved(limb_type *result,
+                                                    const limb_type *lhs,
+                                                    const limb_type *rhs) const {
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+    const size_t size{modulus_limbs.size()};
+
+    // interleaved rows of the product and of the reduction, the running sum stays below 2 * m
+    std::vector<limb_type> sum(size + 2, 0U);
+
+    for (size_t i{}; i < size; ++i) {
+        limb_type carry{detail::multiply_add_limb_sequence_by_limb(sum.data(), lhs, size, rhs[i])};
+        sum[size] += carry;
+        sum[size + 1] = static_cast<limb_type>(sum[size] < carry);
+
+        carry = detail::multiply_add_limb_sequence_by_limb(sum.data(), modulus_limbs.data(), size,
+                                                           sum.front() * negated_inverse_);
+        sum[size] += carry;
+        sum[size + 1] += static_cast<limb_type>(sum[size] < carry);
+
+        std::copy(sum.cbegin() + 1, sum.cend(), sum.begin());
+        sum.back() = 0U;
+    }
+
+    // the final subtraction of m is selected by a mask so that the running time does not depend on the operands
+    std::vector<limb_type> difference(size + 1);
+    const limb_type borrow{detail::subtract_limb_sequences(difference.data(), sum.data(), size + 1,
+                                                           modulus_limbs.data(), size)};
+    const limb_type mask{0U - borrow};
+
+    for (size_t i{}; i < size; ++i)
+        result[i] = (sum[i] & mask) | (difference[i] & ~mask);
+}
+
+void montgomery_context::square_limbs(limb_type *result, const limb_type *limbs) const {
+    const size_t size{modulus_.get_limbs().size()};
+
+    std::vector<limb_type> product(2 * size);
+    detail::square_limb_sequence(product.data(), limbs, size);
+    reduce_limbs(result, product.data());
+}
+
+void montgomery_context::reduce_limbs(limb_type *result, limb_type *product) const {
+    const std::vector<limb_type> &modulus_limbs{modulus_.get_limbs()};
+    const size_t size{modulus_limbs.size()};
+
+    if (size >= BIG_INTEGER_MONTGOMERY_REDC_THRESHOLD) {
+        // (product + ((product * -m^-1) mod R) * m) / R
+        std::vector<limb_type> quotient(2 * size), multiple(2 * size);
+        detail::multiply_limb_sequences(quotient.data(), product, size, negated_inverse_limbs_.data(), size);
+        detail::multiply_limb_sequences(multiple.data(), quotient.data(), size, modulus_limbs.data(), size);
+        const limb_type carry{detail::add_limb_sequences(product, product, 2 * size, multiple.data(), 2 * size)};
+
+        if (carry != 0U || detail::compare_limb_sequences(product + size, modulus_limbs.data(), size) >= 0)
+            detail::subtract_limb_sequences(product + size, product + size, size, modulus_limbs.data(), size);
+
+        std::copy(product + size, product + 2 * size, result);
+        return;
+    }
+
+    // every row clears the lowest remaining limb, the carry out of the top is kept in overflow
+    limb_type overflow{};
+    for (size_t i{}; i < size; ++i) {
+        const limb_type carry{detail::multiply_add_limb_sequence_by_limb(product + i, modulus_limbs.data(), size,
+                                                                         product[i] * negated_inverse_)};
+        limb_type &top{product[i + size]};
+        top += carry;
+        limb_type carry_out{static_cast<limb_type>(top < carry)};
+        top += overflow;
+        carry_out += static_cast<limb_type>(top < overflow);
+        overflow = carry_out;
+    }
+
+    if (overflow != 0U || detail::compare_limb_sequences(product + size, modulus_limbs.data(), size) >= 0)
+        detail::subtract_limb_sequences(product + size, product + size, size, modulus_limbs.data(), size);
+
+    std::copy(product + size, product + 2 * size, result);
+}
+
+big_integer barrett_context::pow(const big_integer &base, const big_integer &exponent) const {
+    if (base.is_nan() || exponent.is_nan() || exponent.is_negative_number() || modulus_.is_nan())
+        return big_integer::nan;
+
+    if (exponent.is_zero())
+        return reduce(big_integer::plus_one);
+
+    const std::vector<limb_type> result{raise_by_sliding_window(
+            reduce(base).get_limbs(), exponent.get_limbs(),
+            [this](std::vector<limb_type> &target, const std::vector<limb_type> &factor) {
+                target = detail::multiply_magnitudes(target, factor);
+                reduce_magnitude(target);
+            },
+            [this](std::vector<limb_type> &target) {
+                target = detail::square_magnitude(target);
+                reduce_magnitude(target);
+            })};
+
+    return big_integer::from_limbs(result);
+}
+
+big_integer montgomery_context::pow(const big_integer &base, const big_integer &exponent) const {
+    if (base.is_nan() || exponent.is_nan() || exponent.is_negative_number() || modulus_.is_nan())
+        return big_integer::nan;
+
+    if (exponent.is_zero())
+        return from_montgomery(to_montgomery(big_integer::plus_one));
+
+    std::vector<limb_type> result{raise_by_sliding_window(
+            get_montgomery_form_limbs(base), exponent.get_limbs(),
+            [this](std::vector<limb_type> &target, const std::vector<limb_type> &factor) {
+                multiply_limbs(target.data(), target.data(), factor.data());
+            },
+            [this](std::vector<limb_type> &target) {
+                square_limbs(target.data(), target.data());
+            })};
+
+    const size_t size{result.size()};
+    result.resize(2 * size, 0U);
+    reduce_limbs(result.data(), result.data());
+    result.resize(size);
+
+    return big_integer::from_limbs(std::move(result));
+}
+
+big_integer montgomery_context::pow_constant_time(const big_integer &base, const big_integer &exponent) const {
+    if (base.is_nan() || exponent.is_nan() || exponent.is_negative_number() || modulus_.is_nan())
+        return big_integer::nan;
+
+    constexpr const size_t window_bit_count{4U};
+    constexpr const size_t table_size{size_t{1} << window_bit_count};
+    const size_t size{modulus_.get_limbs().size()};
+
+    // base^0, ..., base^15 in Montgomery form stored one after the other
+    std::vector<limb_type> powers(table_size * size);
+    const std::vector<limb_type> one_form{get_montgomery_form_limbs(big_integer::plus_one)};
+    const std::vector<limb_type> base_form{get_montgomery_form_limbs(base)};
+    std::copy(one_form.cbegin(), one_form.cend(), powers.begin());
+    for (size_t i{1}; i < table_size; ++i)
+        multiply_limbs_interleaved(&powers[i * size], &powers[(i - 1) * size], base_form.data());
+
+    std::vector<limb_type> result{one_form}, window_power(size);
+    const std::vector<limb_type> &exponent_limbs{exponent.get_limbs()};
+
+    for (size_t window{(detail::get_bit_length(exponent_limbs) + window_bit_count - 1) / window_bit_count};
+         window > 0U; --window) {
+        for (size_t i{}; i < window_bit_count; ++i)
+            multiply_limbs_interleaved(result.data(), result.data(), result.data());
+
+        // every table entry is read and the wanted one is kept by a mask
+        const limb_type index{get_bits(exponent_limbs, (window - 1) * window_bit_count, window_bit_count)};
+        std::fill(window_power.begin(), window_power.end(), 0U);
+        for (size_t i{}; i < table_size; ++i) {
+            const limb_type difference{static_cast<limb_type>(i) ^ index};
+            const limb_type mask{((difference | (0U - difference)) >> (detail::limb_bits - 1)) - 1U};
+
+            for (size_t j{}; j < size; ++j)
+                window_power[j] |= powers[i * size + j] & mask;
+        }
+
+        multiply_limbs_interleaved(result.data(), result.data(), window_power.data());
+    }
+
+    // multiplying by 1 converts back from Montgomery form
+    std::vector<limb_type> one(size, 0U);
+    one.front() = 1U;
+    multiply_limbs_interleaved(result.data(), result.data(), one.data());
+
+    return big_integer::from_limbs(std::move(result));
+}
+
+crt_context::crt_context(const std::vector<big_integer> &moduli) : modulus_{big_integer::plus_one} {
+    std::vector<big_integer> leaves{};
+    leaves.reserve(moduli.size());
+
+    for (const big_integer &modulus : moduli) {
+        if (modulus.is_nan() || modulus.is_zero()) {
+#ifndef BIG_INTEGER_NO_THROW
+            if (modulus.is_zero())
+                throw division_by_zero_error{};
+#endif
+            modulus_ = big_integer::nan;
+            return;
+        }
+        leaves.emplace_back(modulus.abs());
+    }
+
+    products_.emplace_back(std::move(leaves));
+
+    while (products_.back().size() > 1U) {
+        const std::vector<big_integer> &level{products_.back()};
+        std::vector<big_integer> next_level{};
+        std::vector<combination> next_combinations{};
+
+        for (size_t i{}; i + 1 < level.size(); i += 2) {
+            big_integer left_inverse{inverse_mod(level[i], level[i + 1])};
+            if (left_inverse.is_nan()) {
+#ifndef BIG_INTEGER_NO_THROW
+                throw std::invalid_argument{"Chinese remaindering requires pairwise coprime moduli!"};
+#endif
+                modulus_ = big_integer::nan;
+                products_.clear();
+                combinations_.clear();
+                return;
+            }
+
+            next_combinations.push_back({barrett_context{level[i + 1]}, std::move(left_inverse)});
+            next_level.emplace_back(level[i] * level[i + 1]);
+        }
+
+        if (level.size() % 2 != 0U)
+            next_level.emplace_back(level.back());
+
+        combinations_.emplace_back(std::move(next_combinations));
+        products_.emplace_back(std::move(next_level));
+    }
+
+    if (!products_.back().empty())
+        modulus_ = products_.back().front();
+}
+
+const big_integer &crt_context::get_modulus() const noexcept {
+    return modulus_;
+}
+
+big_integer crt_context::reconstruct(const std::vector<big_integer> &residues) const {
+    if (modulus_.is_nan() || residues.size() != products_.front().size())
+        return big_integer::nan;
+
+    std::vector<big_integer> values{};
+    values.reserve(residues.size());
+
+    for (size_t i{}; i < residues.size(); ++i) {
+        if (residues[i].is_nan())
+            return big_integer::nan;
+
+        big_integer value{residues[i] % products_.front()[i]};
+        if (value.is_negative_number())
+            value += products_.front()[i];
+        values.emplace_back(std::move(value));
+    }
+
+    for (size_t level{}; level < combinations_.size(); ++level) {
+        const std::vector<big_integer> &products{products_[level]};
+        std::vector<big_integer> next_values{};
+        next_values.reserve(products_[level + 1].size());
+
+        // x = left + left_product * ((right - left) * left_product^-1 mod right_product)
+        for (size_t i{}; i < combinations_[level].size(); ++i) {
+            const combination &step{combinations_[level][i]};
+            const big_integer &left{values[2 * i]};
+            const big_integer lift{
+                    step.right_modulus.mul_mod(step.right_modulus.reduce(values[2 * i + 1] - left), step.left_inverse)};
+            next_values.emplace_back(left + products[2 * i] * lift);
+        }
+
+        if (values.size() % 2 != 0U)
+            next_values.emplace_back(std::move(values.back()));
+
+        values = std::move(next_values);
+    }
+
+    return values.empty() ? big_integer{} : std::move(values.front());
+}
+
+big_integer org::atib::numerics::inverse_mod(const big_integer &number, const big_integer &modulus) {
+    if (number.is_nan() || modulus.is_nan())
+        return big_integer::nan;
+
+    if (modulus.is_zero()) {
+#ifndef BIG_INTEGER_NO_THROW
+        throw division_by_zero_error{};
+#endif
+        return big_integer::nan;
+    }
+
+    const big_integer positive_modulus{modulus.abs()};
+    const auto [divisor, inverse, modulus_cofactor] = extended_gcd(number % positive_modulus, positive_modulus);
+    if (divisor != big_integer::plus_one)
+        return big_integer::nan;
+
+    return inverse.is_negative_number() ? inverse + positive_modulus : inverse % positive_modulus;
+}
+
+big_integer org::atib::numerics::crt(const std::vector<big_integer> &residues, const std::vector<big_integer> &moduli) {
+    return crt_context{moduli}.reconstruct(residues);
+}
+
+big_integer org::atib::numerics::pow_mod(const big_integer &base,
+                                         const big_integer &exponent,
+                                         const big_integer &modulus) {
+    if (base.is_nan() || exponent.is_nan() || modulus.is_nan() || exponent.is_negative_number())
+        return big_integer::nan;
+
+    if (!modulus.is_zero() && (modulus.get_limbs().front() & 1U) != 0U)
+        return montgomery_context{modulus}.pow(base, exponent);
+
+    return barrett_context{modulus}.pow(base, exponent);
+}
+
+big_integer org::atib::numerics::pow_mod_constant_time(const big_integer &base,
+                                                       const big_integer &exponent,
+                                                       const big_integer &modulus) {
+    return montgomery_context{modulus}.pow_constant_time(base, exponent);
+}
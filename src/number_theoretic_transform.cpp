@@ -0,0 +1,292 @@
+#include "../include/limb_arithmetic.h"
+
+#include <algorithm>
+
+using namespace org::atib::numerics;
+using namespace org::atib::numerics::detail;
+
+namespace {
+
+    // Arithmetic modulo an odd modulus below 2^63 in Montgomery form with R = 2^64. Values in Montgomery form are
+    // only used for constants, multiplying a plain value by a constant in Montgomery form yields a plain value.
+    class montgomery_modulus {
+    public:
+        explicit montgomery_modulus(const limb_type modulus) noexcept
+                : modulus_{modulus}, modulus_inverse_{modulus}, r_squared_{} {
+            for (size_t i{}; i < 5U; ++i)
+                modulus_inverse_ *= 2U - modulus * modulus_inverse_;
+
+            limb_type r_modulo{};
+            divide_double_limb(1U, 0U, modulus, r_modulo);
+
+            limb_type high;
+            const limb_type low{multiply_two_limbs(r_modulo, r_modulo, high)};
+            divide_double_limb(high, low, modulus, r_squared_);
+        }
+
+        limb_type get_modulus() const noexcept { return modulus_; }
+
+        // lhs * rhs / R modulo the modulus
+        limb_type multiply(const limb_type lhs, const limb_type rhs) const noexcept {
+            limb_type high;
+            const limb_type low{multiply_two_limbs(lhs, rhs, high)};
+            limb_type reduction_high;
+            multiply_two_limbs(low * modulus_inverse_, modulus_, reduction_high);
+            const limb_type result{high - reduction_high};
+            return high < reduction_high ? result + modulus_ : result;
+        }
+
+        limb_type add(const limb_type lhs, const limb_type rhs) const noexcept {
+            const limb_type sum{lhs + rhs};
+            return sum >= modulus_ ? sum - modulus_ : sum;
+        }
+
+        limb_type subtract(const limb_type lhs, const limb_type rhs) const noexcept {
+            return lhs >= rhs ? lhs - rhs : lhs + modulus_ - rhs;
+        }
+
+        limb_type reduce(limb_type value) const noexcept {
+            while (value >= modulus_)
+                value -= modulus_;
+            return value;
+        }
+
+        limb_type to_montgomery_form(const limb_type value) const noexcept {
+            return multiply(reduce(value), r_squared_);
+        }
+
+        limb_type power(const limb_type base_in_montgomery_form, limb_type exponent) const noexcept {
+            limb_type result{to_montgomery_form(1U)};
+            limb_type base{base_in_montgomery_form};
+
+            for (; exponent > 0U; exponent >>= 1U) {
+                if (0U != (exponent & 1U))
+                    result = multiply(result, base);
+                base = multiply(base, base);
+            }
+
+            return result;
+        }
+
+        limb_type inverse(const limb_type value_in_montgomery_form) const noexcept {
+            return power(value_in_montgomery_form, modulus_ - 2);
+        }
+
+    private:
+        limb_type modulus_;
+        limb_type modulus_inverse_;
+        limb_type r_squared_;
+    };
+
+    struct ntt_prime {
+        limb_type modulus;
+        limb_type primitive_root;
+    };
+
+    // Primes of the form c * 2^50 + 1 below 2^62, their product exceeds n * 2^128 for every transform length n
+    // up to 2^50 so the convolution of 64-bit limbs can be reconstructed exactly.
+    static constexpr const ntt_prime ntt_primes[3]{
+            {4601552919265804289ULL, 3U},
+            {4546383823830515713ULL, 10U},
+            {4522739925786820609ULL, 37U}
+    };
+
+    static constexpr const size_t max_ntt_length_bits{50U};
+
+    // Constants of Garner's algorithm, all of them in Montgomery form of the modulus they are used with.
+    struct garner_constants {
+        montgomery_modulus first_modulus{ntt_primes[0].modulus};
+        montgomery_modulus second_modulus{ntt_primes[1].modulus};
+        montgomery_modulus third_modulus{ntt_primes[2].modulus};
+        limb_type first_inverse_modulo_second{
+                second_modulus.inverse(second_modulus.to_montgomery_form(ntt_primes[0].modulus))
+        };
+        limb_type first_modulo_third{third_modulus.to_montgomery_form(ntt_primes[0].modulus)};
+        limb_type first_times_second_inverse_modulo_third{
+                third_modulus.inverse(third_modulus.multiply(
+                        first_modulo_third, third_modulus.to_montgomery_form(ntt_primes[1].modulus)))
+        };
+        limb_type first_times_second_low{};
+        limb_type first_times_second_high{};
+
+        garner_constants() noexcept {
+            first_times_second_low = multiply_two_limbs(ntt_primes[0].modulus, ntt_primes[1].modulus,
+                                                        first_times_second_high);
+        }
+    };
+
+    // Twiddle factors in Montgomery form, the ones of the butterflies spanning half elements are stored at
+    // [half, 2 * half).
+    limb_vector compute_ntt_twiddle_factors(const montgomery_modulus &modulus,
+                                            const limb_type primitive_root,
+                                            const size_t length,
+                                            const bool is_inverse) {
+        limb_vector twiddle_factors(length);
+        const limb_type root{modulus.to_montgomery_form(primitive_root)};
+
+        for (size_t half{1}; half < length; half *= 2) {
+            limb_type step{modulus.power(root, (modulus.get_modulus() - 1) / (2 * half))};
+            if (is_inverse)
+                step = modulus.inverse(step);
+
+            limb_type factor{modulus.to_montgomery_form(1U)};
+            for (size_t j{}; j < half; ++j) {
+                twiddle_factors[half + j] = factor;
+                factor = modulus.multiply(factor, step);
+            }
+        }
+
+        return twiddle_factors;
+    }
+
+    // Decimation in frequency, the output is in bit-reversed order.
+    void forward_ntt(limb_vector &values, const limb_vector &twiddle_factors, const montgomery_modulus &modulus) {
+        const size_t length{values.size()};
+
+        for (size_t half{length / 2}; half > 0U; half /= 2) {
+            for (size_t start{}; start < length; start += 2 * half) {
+                limb_type *lower{values.data() + start};
+                limb_type *upper{lower + half};
+                const limb_type *factors{twiddle_factors.data() + half};
+
+                for (size_t j{}; j < half; ++j) {
+                    const limb_type u{lower[j]}, v{upper[j]};
+                    lower[j] = modulus.add(u, v);
+                    upper[j] = modulus.multiply(modulus.subtract(u, v), factors[j]);
+                }
+            }
+        }
+    }
+
+    // Decimation in time taking its input in bit-reversed order, the result is not scaled by 1 / length.
+    void inverse_ntt(limb_vector &values, const limb_vector &twiddle_factors, const montgomery_modulus &modulus) {
+        const size_t length{values.size()};
+
+        for (size_t half{1}; half < length; half *= 2) {
+            for (size_t start{}; start < length; start += 2 * half) {
+                limb_type *lower{values.data() + start};
+                limb_type *upper{lower + half};
+                const limb_type *factors{twiddle_factors.data() + half};
+
+                for (size_t j{}; j < half; ++j) {
+                    const limb_type u{lower[j]}, v{modulus.multiply(upper[j], factors[j])};
+                    lower[j] = modulus.add(u, v);
+                    upper[j] = modulus.subtract(u, v);
+                }
+            }
+        }
+    }
+
+    // Cyclic convolution of lhs and rhs modulo the given prime, length must be a power of two of at least
+    // lhs_size + rhs_size - 1.
+    limb_vector convolve_modulo_prime(const limb_type *lhs,
+                                      const size_t lhs_size,
+                                      const limb_type *rhs,
+                                      const size_t rhs_size,
+                                      const size_t length,
+                                      const montgomery_modulus &modulus,
+                                      const limb_type primitive_root) {
+        // the transform of a square's operand is computed only once
+        const bool is_square{lhs == rhs};
+        const limb_vector twiddle_factors{compute_ntt_twiddle_factors(modulus, primitive_root, length, false)};
+
+        limb_vector lhs_values(length), rhs_values(is_square ? 0U : length);
+        std::transform(lhs, lhs + lhs_size, std::begin(lhs_values),
+                       [&modulus](const limb_type limb) { return modulus.reduce(limb); });
+        forward_ntt(lhs_values, twiddle_factors, modulus);
+
+        if (!is_square) {
+            std::transform(rhs, rhs + rhs_size, std::begin(rhs_values),
+                           [&modulus](const limb_type limb) { return modulus.reduce(limb); });
+            forward_ntt(rhs_values, twiddle_factors, modulus);
+        }
+
+        const limb_vector &transformed_rhs{is_square ? lhs_values : rhs_values};
+
+        // the pointwise product is multiplied by R^2 / length to undo the reduction by R and the scaling by length
+        const limb_type length_inverse{modulus.inverse(modulus.to_montgomery_form(length))};
+        const limb_type scale{modulus.to_montgomery_form(length_inverse)};
+
+        for (size_t i{}; i < length; ++i)
+            lhs_values[i] = modulus.multiply(modulus.multiply(lhs_values[i], transformed_rhs[i]), scale);
+
+        inverse_ntt(lhs_values, compute_ntt_twiddle_factors(modulus, primitive_root, length, true), modulus);
+
+        return lhs_values;
+    }
+
+}// namespace
+
+void org::atib::numerics::detail::multiply_limb_sequences_ntt(limb_type *result,
+                                                              const limb_type *lhs,
+                                                              const size_t lhs_size,
+                                                              const limb_type *rhs,
+                                                              const size_t rhs_size) {
+    static const garner_constants constants{};
+
+    const size_t result_size{lhs_size + rhs_size};
+    size_t length{1};
+    while (length < result_size - 1)
+        length *= 2;
+
+    if (length > (size_t{1} << max_ntt_length_bits)) {
+        multiply_limb_sequences_toom4(result, lhs, lhs_size, rhs, rhs_size);
+        return;
+    }
+
+    const montgomery_modulus *moduli[3]{&constants.first_modulus, &constants.second_modulus, &constants.third_modulus};
+    limb_vector residues[3];
+
+    for (size_t i{}; i < 3U; ++i)
+        residues[i] = convolve_modulo_prime(lhs, lhs_size, rhs, rhs_size, length, *moduli[i], ntt_primes[i].primitive_root);
+
+    const montgomery_modulus &second_modulus{constants.second_modulus};
+    const montgomery_modulus &third_modulus{constants.third_modulus};
+    limb_type carry[3]{};
+
+    for (size_t i{}; i < result_size; ++i) {
+        limb_type coefficient[3]{};
+
+        if (i < length) {
+            // coefficient = first + p1 * second_digit + p1 * p2 * third_digit
+            const limb_type first{residues[0][i]};
+            const limb_type second_digit{
+                    second_modulus.multiply(second_modulus.subtract(residues[1][i], second_modulus.reduce(first)),
+                                            constants.first_inverse_modulo_second)
+            };
+
+            limb_type partial_high;
+            limb_type partial_low{multiply_two_limbs(ntt_primes[0].modulus, second_digit, partial_high)};
+            partial_low += first;
+            partial_high += static_cast<limb_type>(partial_low < first);
+
+            limb_type partial_modulo_third{third_modulus.reduce(partial_high)};
+            divide_double_limb(partial_modulo_third, partial_low, ntt_primes[2].modulus, partial_modulo_third);
+
+            const limb_type third_digit{
+                    third_modulus.multiply(third_modulus.subtract(residues[2][i], partial_modulo_third),
+                                           constants.first_times_second_inverse_modulo_third)
+            };
+
+            limb_type low_product_high, high_product_high;
+            const limb_type low_product_low{
+                    multiply_two_limbs(constants.first_times_second_low, third_digit, low_product_high)
+            };
+            const limb_type high_product_low{
+                    multiply_two_limbs(constants.first_times_second_high, third_digit, high_product_high)
+            };
+
+            const limb_type product[3]{low_product_low, low_product_high + high_product_low,
+                                       high_product_high +
+                                       static_cast<limb_type>(low_product_high + high_product_low < high_product_low)};
+            const limb_type partial[2]{partial_low, partial_high};
+            coefficient[2] = product[2] + add_limb_sequences(coefficient, product, 2U, partial, 2U);
+        }
+
+        const limb_type carry_out{add_limb_sequences(carry, carry, 3U, coefficient, 3U)};
+        result[i] = carry[0];
+        carry[0] = carry[1];
+        carry[1] = carry[2];
+        carry[2] = carry_out;
+    }
+}
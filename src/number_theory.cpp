@@ -0,0 +1,682 @@
+#include "../include/number_theory.h"
+
+#include <array>
+
+using namespace org::atib::numerics;
+
+namespace {
+
+    using limb_type = detail::limb_type;
+    using limb_vector = detail::limb_vector;
+
+    // base^exponent > limit for single limbs, stopping as soon as the power exceeds limit
+    bool is_power_greater(const limb_type base, const std::uint64_t exponent, const limb_type limit) noexcept {
+        // powers of 0 and 1 never grow, exponents up to 2^64 must not be stepped through
+        if (base <= 1U)
+            return (0U == exponent ? limb_type{1U} : base) > limit;
+
+        limb_type power{1U};
+
+        for (std::uint64_t i{}; i < exponent; ++i) {
+            limb_type high;
+            power = detail::multiply_two_limbs(power, base, high);
+            if (high != 0U || power > limit)
+                return true;
+        }
+
+        return false;
+    }
+
+    limb_type compute_root_of_limb(const limb_type number, const std::uint64_t degree) {
+        if (1U == degree)
+            return number;
+
+        // the floating point estimate is off by at most a few units
+        const double estimate{std::pow(static_cast<double>(number), 1.0 / static_cast<double>(degree))};
+        limb_type root{static_cast<limb_type>(estimate)};
+
+        while (root > 0U && is_power_greater(root, degree, number))
+            --root;
+        while (!is_power_greater(root + 1, degree, number))
+            ++root;
+
+        return root;
+    }
+
+    limb_vector raise_magnitude(const limb_vector &base, const std::uint64_t exponent) {
+        if (0U == exponent)
+            return {1U};
+
+        limb_vector result{base};
+        for (size_t i{detail::limb_bits - 1 - detail::count_leading_zero_bits(exponent)}; i > 0U; --i) {
+            result = detail::square_magnitude(result);
+            if (((exponent >> (i - 1)) & 1U) != 0U)
+                result = detail::multiply_magnitudes(result, base);
+        }
+
+        return result;
+    }
+
+    // floor(number^(1 / degree)) for a positive degree
+    limb_vector compute_root_magnitude(const limb_vector &number, const std::uint64_t degree) {
+        const size_t bit_count{detail::get_bit_length(number)};
+        if (number.empty())
+            return {};
+
+        // 0 < number < 2^bit_count <= 2^degree
+        if (degree >= bit_count)
+            return {1U};
+
+        if (bit_count <= detail::limb_bits) {
+            const limb_type root{compute_root_of_limb(number.front(), degree)};
+            return 0U == root ? limb_vector{} : limb_vector{root};
+        }
+
+        // the root of the top half of the root's bits plus one, shifted into place, is at least the root and is
+        // precise enough for Newton's iteration to converge in a few steps. Roots below 4, where bit_count is less
+        // than 2 * degree, are seeded with 2^ceil(bit_count / degree).
+        const size_t shift{bit_count / (2 * degree)};
+        limb_vector root{};
+        if (0U == shift) {
+            root = detail::shift_magnitude_left({1U}, (bit_count + degree - 1) / degree);
+        } else {
+            root = compute_root_magnitude(detail::shift_magnitude_right(number, degree * shift), degree);
+            root = detail::shift_magnitude_left(detail::add_magnitudes(root, {1U}), shift);
+        }
+
+        // x' = ((degree - 1) * x + number / x^(degree - 1)) / degree decreases towards the root from above
+        for (;;) {
+            limb_vector quotient{}, remainder{};
+            detail::divide_magnitudes(number, 2U == degree ? root : raise_magnitude(root, degree - 1), quotient,
+                                      remainder);
+
+            limb_vector next(root.size() + 1, 0U);
+            next.back() = detail::multiply_limb_sequence_by_limb(next.data(), root.data(), root.size(), degree - 1);
+            next = detail::add_magnitudes(next, quotient);
+            detail::divide_magnitude_by_limb(next, degree);
+
+            if (detail::compare_magnitudes(next, root) >= 0)
+                return root;
+
+            root = std::move(next);
+
+            // a square root seeded from the top half is at most one too large after a single step, which is cheaper
+            // to check by squaring than by another division
+            if (2U == degree) {
+                if (detail::compare_magnitudes(detail::square_magnitude(root), number) > 0)
+                    root = detail::subtract_magnitudes(root, {1U});
+                return root;
+            }
+        }
+    }
+
+    template<size_t Modulus>
+    constexpr std::array<bool, Modulus> make_quadratic_residue_table() {
+        std::array<bool, Modulus> is_residue{};
+        for (size_t i{}; i < Modulus; ++i)
+            is_residue[i * i % Modulus] = true;
+        return is_residue;
+    }
+
+    // 12 of 64, 16 of 63, 21 of 65 and 6 of 11 residues are squares, together letting through 1 in 119 non-squares
+    constexpr std::array<bool, 64> is_square_modulo_64{make_quadratic_residue_table<64>()};
+    constexpr std::array<bool, 63> is_square_modulo_63{make_quadratic_residue_table<63>()};
+    constexpr std::array<bool, 65> is_square_modulo_65{make_quadratic_residue_table<65>()};
+    constexpr std::array<bool, 11> is_square_modulo_11{make_quadratic_residue_table<11>()};
+
+    bool is_prime_limb(const limb_type number) noexcept {
+        if (number < 4U)
+            return number > 1U;
+        if (0U == number % 2U)
+            return false;
+        for (limb_type divisor{3U}; divisor * divisor <= number; divisor += 2U) {
+            if (0U == number % divisor)
+                return false;
+        }
+        return true;
+    }
+
+    bool is_square_residue(const limb_vector &magnitude) noexcept {
+        if (!is_square_modulo_64[(magnitude.empty() ? limb_type{} : magnitude.front()) % 64U])
+            return false;
+
+        // 45045 = 63 * 65 * 11
+        const limb_type remainder{detail::get_magnitude_remainder(magnitude, 45045U)};
+        return is_square_modulo_63[remainder % 63U] && is_square_modulo_65[remainder % 65U] &&
+               is_square_modulo_11[remainder % 11U];
+    }
+
+    // base^exponent mod a modulus below 2^32, in constant expressions
+    constexpr size_t raise_modulo_small(size_t base, size_t exponent, const size_t modulus) {
+        size_t power{1U % modulus};
+        for (base %= modulus; exponent > 0U; exponent >>= 1U) {
+            if ((exponent & 1U) != 0U)
+                power = power * base % modulus;
+            base = base * base % modulus;
+        }
+        return power;
+    }
+
+    template<size_t Modulus>
+    constexpr std::array<std::array<bool, Modulus>, 64> make_power_residue_tables() {
+        std::array<std::array<bool, Modulus>, 64> is_residue{};
+        for (size_t degree{}; degree < 64U; ++degree) {
+            for (size_t i{}; i < Modulus; ++i)
+                is_residue[degree][raise_modulo_small(i, degree, Modulus)] = true;
+        }
+        return is_residue;
+    }
+
+    // is_power_modulo_m[degree][r] tells whether r is a degree-th power modulo m, for degrees below 64
+    constexpr std::array<std::array<bool, 64>, 64> is_power_modulo_64{make_power_residue_tables<64>()};
+    constexpr std::array<std::array<bool, 63>, 64> is_power_modulo_63{make_power_residue_tables<63>()};
+    constexpr std::array<std::array<bool, 65>, 64> is_power_modulo_65{make_power_residue_tables<65>()};
+    constexpr std::array<std::array<bool, 11>, 64> is_power_modulo_11{make_power_residue_tables<11>()};
+
+    // Whether magnitude can be a degree-th power for an odd prime degree. Small degrees are checked modulo 64, 63, 65
+    // and 11, every degree modulo two primes q = 2 * k * degree + 1 of which only (q - 1) / degree + 1 residues are
+    // degree-th powers.
+    bool is_power_residue(const limb_vector &magnitude, const std::uint64_t degree) {
+        if (degree < 64U) {
+            const limb_type remainder{detail::get_magnitude_remainder(magnitude, 45045U)};
+
+            if (!is_power_modulo_64[degree][magnitude.front() % 64U] || !is_power_modulo_63[degree][remainder % 63U] ||
+                !is_power_modulo_65[degree][remainder % 65U] || !is_power_modulo_11[degree][remainder % 11U])
+                return false;
+        }
+
+        size_t checked_prime_count{};
+        for (limb_type prime{2 * degree + 1}; checked_prime_count < 2U && prime < (limb_type{1} << 32U);
+             prime += 2 * degree) {
+            if (!is_prime_limb(prime))
+                continue;
+
+            const limb_type power{detail::raise_modulo_limb(detail::get_magnitude_remainder(magnitude, prime),
+                                                            (prime - 1) / degree, prime)};
+            if (power > 1U)
+                return false;
+            ++checked_prime_count;
+        }
+
+        return true;
+    }
+
+    limb_type compute_limb_gcd(limb_type lhs, limb_type rhs) noexcept {
+        if (0U == lhs || 0U == rhs)
+            return lhs | rhs;
+
+        // binary GCD: common factors of two are restored at the end, others removed before every subtraction
+        const size_t shift{detail::count_trailing_zero_bits(lhs | rhs)};
+        lhs >>= detail::count_trailing_zero_bits(lhs);
+        do {
+            rhs >>= detail::count_trailing_zero_bits(rhs);
+            if (lhs > rhs)
+                std::swap(lhs, rhs);
+            rhs -= lhs;
+        } while (rhs != 0U);
+
+        return lhs << shift;
+    }
+
+    // gcd(lhs, rhs) for lhs >= rhs > 0 with lhs * lhs_cofactor + rhs * rhs_cofactor = gcd, the cofactors' magnitudes
+    // are bounded by the operands and alternate in sign from step to step
+    limb_type compute_limb_gcd_extended(limb_type lhs,
+                                        limb_type rhs,
+                                        big_integer &lhs_cofactor,
+                                        big_integer &rhs_cofactor) {
+        limb_type lhs_magnitude{1U}, next_lhs_magnitude{}, rhs_magnitude{}, next_rhs_magnitude{1U};
+        bool is_odd_step_count{};
+
+        while (rhs != 0U) {
+            const limb_type quotient{lhs / rhs}, remainder{lhs % rhs};
+            lhs = rhs;
+            rhs = remainder;
+
+            const limb_type lhs_next{lhs_magnitude + quotient * next_lhs_magnitude};
+            const limb_type rhs_next{rhs_magnitude + quotient * next_rhs_magnitude};
+            lhs_magnitude = next_lhs_magnitude;
+            next_lhs_magnitude = lhs_next;
+            rhs_magnitude = next_rhs_magnitude;
+            next_rhs_magnitude = rhs_next;
+            is_odd_step_count = !is_odd_step_count;
+        }
+
+        lhs_cofactor = big_integer::from_limbs({lhs_magnitude}, is_odd_step_count);
+        rhs_cofactor = big_integer::from_limbs({rhs_magnitude}, !is_odd_step_count);
+        return lhs;
+    }
+
+    // Lehmer steps work on this many leading bits, leaving room for the cofactors in signed 64-bit sums
+    constexpr size_t lehmer_digit_bits{60U};
+
+    // (a, b) -> (t00 * a + t01 * b, t10 * a + t11 * b), with determinant +-1 like every product of Euclidean steps
+    struct lehmer_matrix {
+        std::int64_t t00{1}, t01{}, t10{}, t11{1};
+    };
+
+    struct reduction_matrix {
+        big_integer t00{big_integer::plus_one}, t01{}, t10{}, t11{big_integer::plus_one};
+    };
+
+    std::int64_t get_lehmer_digit(const limb_vector &limbs, const size_t shift) noexcept {
+        const size_t index{shift / detail::limb_bits}, offset{shift % detail::limb_bits};
+        if (index >= limbs.size())
+            return 0;
+
+        limb_type digit{limbs[index] >> offset};
+        if (offset != 0U && index + 1 < limbs.size())
+            digit |= limbs[index + 1] << (detail::limb_bits - offset);
+
+        return static_cast<std::int64_t>(digit & ((limb_type{1} << lehmer_digit_bits) - 1));
+    }
+
+    // Knuth's algorithm L: the Euclidean quotients of the leading bits of a >= b, for a of more than one limb, as long
+    // as they are the same for the largest and smallest numbers with these leading bits and thus quotients of a and b.
+    // Quotients whose remainder's leading bits fall below stop_bit_count bits are left out. False if not even the
+    // first quotient is determined.
+    bool compute_lehmer_matrix(const limb_vector &a,
+                               const limb_vector &b,
+                               const size_t stop_bit_count,
+                               lehmer_matrix &matrix) noexcept {
+        const size_t shift{detail::get_bit_length(a) - lehmer_digit_bits};
+        std::int64_t a_digit{get_lehmer_digit(a, shift)}, b_digit{get_lehmer_digit(b, shift)};
+
+        if (stop_bit_count >= shift + lehmer_digit_bits)
+            return false;
+        const std::int64_t minimum_digit{stop_bit_count <= shift ? 0 : std::int64_t{1} << (stop_bit_count - shift)};
+
+        matrix = {};
+        while (b_digit + matrix.t10 != 0 && b_digit + matrix.t11 != 0) {
+            const std::int64_t quotient{(a_digit + matrix.t00) / (b_digit + matrix.t10)};
+            if (quotient != (a_digit + matrix.t01) / (b_digit + matrix.t11))
+                break;
+
+            const std::int64_t remainder{a_digit - quotient * b_digit};
+            if (remainder < minimum_digit)
+                break;
+
+            matrix = {matrix.t10, matrix.t11, matrix.t00 - quotient * matrix.t10, matrix.t01 - quotient * matrix.t11};
+            a_digit = b_digit;
+            b_digit = remainder;
+        }
+
+        return matrix.t01 != 0;
+    }
+
+    // result += factor * magnitude for a result long enough to hold the sum, false if it would become negative
+    bool add_product(limb_vector &result, const limb_vector &magnitude, const std::int64_t factor) noexcept {
+        const bool is_subtraction{factor < 0};
+        const limb_type multiplier{is_subtraction ? 0U - static_cast<limb_type>(factor)
+                                                  : static_cast<limb_type>(factor)};
+        limb_type carry{is_subtraction ? detail::multiply_subtract_limb_sequence_by_limb(
+                                                 result.data(), magnitude.data(), magnitude.size(), multiplier)
+                                       : detail::multiply_add_limb_sequence_by_limb(
+                                                 result.data(), magnitude.data(), magnitude.size(), multiplier)};
+
+        for (size_t i{magnitude.size()}; carry != 0U && i < result.size(); ++i) {
+            const limb_type limb{result[i]};
+            result[i] = is_subtraction ? limb - carry : limb + carry;
+            carry = is_subtraction ? limb < carry : result[i] < limb;
+        }
+
+        return 0U == carry;
+    }
+
+    // result = lhs_factor * lhs + rhs_factor * rhs, false if that is negative
+    bool combine_magnitudes(const limb_vector &lhs,
+                            const std::int64_t lhs_factor,
+                            const limb_vector &rhs,
+                            const std::int64_t rhs_factor,
+                            limb_vector &result) {
+        result.assign(std::max(lhs.size(), rhs.size()) + 2, 0U);
+
+        // the positive product first, so that subtracting the other one only borrows for negative results
+        const bool is_combined{lhs_factor < 0
+                                       ? add_product(result, rhs, rhs_factor) && add_product(result, lhs, lhs_factor)
+                                       : add_product(result, lhs, lhs_factor) && add_product(result, rhs, rhs_factor)};
+
+        detail::trim_leading_zero_limbs(result);
+        return is_combined;
+    }
+
+    // (first, second) -> (t00 * first + t01 * second, t10 * first + t11 * second)
+    void transform_pair(big_integer &first,
+                        big_integer &second,
+                        const big_integer &t00,
+                        const big_integer &t01,
+                        const big_integer &t10,
+                        const big_integer &t11) {
+        big_integer next_first{t00 * first + t01 * second};
+        second = t10 * first + t11 * second;
+        first = std::move(next_first);
+    }
+
+    // matrix = step * matrix
+    void premultiply(reduction_matrix &matrix,
+                     const big_integer &t00,
+                     const big_integer &t01,
+                     const big_integer &t10,
+                     const big_integer &t11) {
+        transform_pair(matrix.t00, matrix.t10, t00, t01, t10, t11);
+        transform_pair(matrix.t01, matrix.t11, t00, t01, t10, t11);
+    }
+
+    limb_vector multiply_magnitude_by_limb(const limb_vector &magnitude, const limb_type factor) {
+        limb_vector product(magnitude.size() + 1, 0U);
+        product.back() =
+                detail::multiply_limb_sequence_by_limb(product.data(), magnitude.data(), magnitude.size(), factor);
+        detail::trim_leading_zero_limbs(product);
+        return product;
+    }
+
+    // lhs_factor * lhs + rhs_factor * rhs by products with single limbs
+    big_integer combine_numbers(const big_integer &lhs,
+                                const std::int64_t lhs_factor,
+                                const big_integer &rhs,
+                                const std::int64_t rhs_factor) {
+        const limb_vector lhs_product{multiply_magnitude_by_limb(
+                lhs.get_limbs(),
+                lhs_factor < 0 ? 0U - static_cast<limb_type>(lhs_factor) : static_cast<limb_type>(lhs_factor))};
+        const limb_vector rhs_product{multiply_magnitude_by_limb(
+                rhs.get_limbs(),
+                rhs_factor < 0 ? 0U - static_cast<limb_type>(rhs_factor) : static_cast<limb_type>(rhs_factor))};
+        const bool is_negative_lhs_product{lhs.is_negative_number() != (lhs_factor < 0)};
+        const bool is_negative_rhs_product{rhs.is_negative_number() != (rhs_factor < 0)};
+
+        if (is_negative_lhs_product == is_negative_rhs_product)
+            return big_integer::from_limbs(detail::add_magnitudes(lhs_product, rhs_product), is_negative_lhs_product);
+
+        if (detail::compare_magnitudes(lhs_product, rhs_product) >= 0)
+            return big_integer::from_limbs(detail::subtract_magnitudes(lhs_product, rhs_product),
+                                           is_negative_lhs_product);
+        return big_integer::from_limbs(detail::subtract_magnitudes(rhs_product, lhs_product), is_negative_rhs_product);
+    }
+
+    void transform_pair(big_integer &first, big_integer &second, const lehmer_matrix &step) {
+        big_integer next_first{combine_numbers(first, step.t00, second, step.t01)};
+        second = combine_numbers(first, step.t10, second, step.t11);
+        first = std::move(next_first);
+    }
+
+    void premultiply(reduction_matrix &matrix, const lehmer_matrix &step) {
+        transform_pair(matrix.t00, matrix.t10, step);
+        transform_pair(matrix.t01, matrix.t11, step);
+    }
+
+    bool is_identity(const reduction_matrix &matrix) noexcept {
+        return matrix.t01.is_zero() && matrix.t10.is_zero();
+    }
+
+    limb_vector get_top_limbs(const limb_vector &limbs, const size_t offset) {
+        return offset < limbs.size() ? limb_vector(limbs.cbegin() + offset, limbs.cend()) : limb_vector{};
+    }
+
+    // applies matrix to a >= b unless it does not leave a >= b >= 0
+    bool reduce_by_matrix(limb_vector &a, limb_vector &b, const reduction_matrix &matrix) {
+        big_integer next_a{big_integer::from_limbs(a)}, next_b{big_integer::from_limbs(b)};
+        transform_pair(next_a, next_b, matrix.t00, matrix.t01, matrix.t10, matrix.t11);
+
+        if (next_b.is_negative_number() || next_a < next_b)
+            return false;
+
+        a = next_a.get_limbs();
+        b = next_b.get_limbs();
+        return true;
+    }
+
+    // One Euclidean step on a >= b keeping both longer than stop_size limbs. When the remainder would be too short b
+    // is subtracted one time less than the quotient, which ends the reduction: false if no further step is possible.
+    bool reduce_by_division(limb_vector &a, limb_vector &b, const size_t stop_size, reduction_matrix &matrix) {
+        limb_vector quotient{}, remainder{};
+        detail::divide_magnitudes(a, b, quotient, remainder);
+
+        if (remainder.size() > stop_size) {
+            premultiply(matrix, big_integer{}, big_integer::plus_one, big_integer::plus_one,
+                        -big_integer::from_limbs(std::move(quotient)));
+            a = std::move(b);
+            b = std::move(remainder);
+            return true;
+        }
+
+        quotient = detail::subtract_magnitudes(quotient, {1U});
+        if (!quotient.empty()) {
+            premultiply(matrix, big_integer::plus_one, -big_integer::from_limbs(std::move(quotient)), big_integer{},
+                        big_integer::plus_one);
+            a = detail::add_magnitudes(remainder, b);
+        }
+
+        return false;
+    }
+
+    // Euclidean steps on a >= b, by Lehmer steps where possible, while b is longer than stop_size and a longer than
+    // target_size limbs
+    void reduce_by_lehmer_steps(limb_vector &a,
+                                limb_vector &b,
+                                const size_t stop_size,
+                                const size_t target_size,
+                                reduction_matrix &matrix) {
+        while (b.size() > stop_size && a.size() > target_size) {
+            lehmer_matrix step{};
+            limb_vector next_a{}, next_b{};
+
+            if (b.size() > 1U && compute_lehmer_matrix(a, b, stop_size * detail::limb_bits, step) &&
+                combine_magnitudes(a, step.t00, b, step.t01, next_a) &&
+                combine_magnitudes(a, step.t10, b, step.t11, next_b) && next_b.size() > stop_size) {
+                premultiply(matrix, step);
+                a = std::move(next_a);
+                b = std::move(next_b);
+            } else if (!reduce_by_division(a, b, stop_size, matrix)) {
+                return;
+            }
+        }
+    }
+
+    // The matrix of the Euclidean steps reducing a >= b of n limbs until b has n / 2 + 1 limbs or less, stopping one
+    // step early so that both keep more. Those quotients only depend on the top half of a and b, which lets the top
+    // halves' matrix reduce the full numbers to about 3 / 4 of their size and a second recursion the rest (Moeller's
+    // half-GCD).
+    reduction_matrix compute_half_gcd_matrix(limb_vector a, limb_vector b) {
+        const size_t size{a.size()}, stop_size{size / 2 + 1};
+        reduction_matrix matrix{};
+
+        if (b.size() <= stop_size)
+            return matrix;
+
+        if (size < BIG_INTEGER_HALF_GCD_THRESHOLD) {
+            reduce_by_lehmer_steps(a, b, stop_size, 0U, matrix);
+            return matrix;
+        }
+
+        const size_t offset{size / 2};
+        reduction_matrix top_matrix{compute_half_gcd_matrix(get_top_limbs(a, offset), get_top_limbs(b, offset))};
+        if (!is_identity(top_matrix) && reduce_by_matrix(a, b, top_matrix))
+            matrix = std::move(top_matrix);
+
+        reduce_by_lehmer_steps(a, b, stop_size, 3 * size / 4 + 1, matrix);
+        if (b.size() <= stop_size)
+            return matrix;
+
+        // the top 2 * (a.size() - stop_size) - 1 limbs reduce a and b to about stop_size limbs
+        const size_t second_offset{2 * stop_size - a.size() + 1};
+        const reduction_matrix second_matrix{
+                compute_half_gcd_matrix(get_top_limbs(a, second_offset), get_top_limbs(b, second_offset))};
+        if (!is_identity(second_matrix) && reduce_by_matrix(a, b, second_matrix))
+            premultiply(matrix, second_matrix.t00, second_matrix.t01, second_matrix.t10, second_matrix.t11);
+
+        reduce_by_lehmer_steps(a, b, stop_size, 0U, matrix);
+        return matrix;
+    }
+
+    // gcd(a, b) of magnitudes, and when cofactor is given the s of a * s + b * t = gcd. Long operands are reduced by
+    // half-GCD matrices, the rest by Lehmer steps and single limbs by binary GCD, falling back to a division whenever
+    // a step makes no progress.
+    limb_vector compute_gcd_magnitude(limb_vector a, limb_vector b, big_integer *cofactor) {
+        // a = a_cofactor * a0 and b = b_cofactor * a0 modulo the original b0
+        big_integer a_cofactor{big_integer::plus_one}, b_cofactor{};
+        if (detail::compare_magnitudes(a, b) < 0) {
+            a.swap(b);
+            a_cofactor.swap(b_cofactor);
+        }
+
+        while (!b.empty()) {
+            if (b.size() >= BIG_INTEGER_HALF_GCD_THRESHOLD) {
+                const size_t offset{a.size() / 2};
+                const reduction_matrix matrix{
+                        compute_half_gcd_matrix(get_top_limbs(a, offset), get_top_limbs(b, offset))};
+
+                if (!is_identity(matrix) && reduce_by_matrix(a, b, matrix)) {
+                    if (cofactor != nullptr)
+                        transform_pair(a_cofactor, b_cofactor, matrix.t00, matrix.t01, matrix.t10, matrix.t11);
+                    continue;
+                }
+            } else if (b.size() > 1U) {
+                lehmer_matrix step{};
+                limb_vector next_a{}, next_b{};
+
+                if (compute_lehmer_matrix(a, b, 0U, step) && combine_magnitudes(a, step.t00, b, step.t01, next_a) &&
+                    combine_magnitudes(a, step.t10, b, step.t11, next_b)) {
+                    if (cofactor != nullptr)
+                        transform_pair(a_cofactor, b_cofactor, step);
+                    a = std::move(next_a);
+                    b = std::move(next_b);
+                    continue;
+                }
+            } else if (1U == a.size()) {
+                if (cofactor != nullptr) {
+                    big_integer lhs_cofactor{}, rhs_cofactor{};
+                    a.front() = compute_limb_gcd_extended(a.front(), b.front(), lhs_cofactor, rhs_cofactor);
+                    a_cofactor = lhs_cofactor * a_cofactor + rhs_cofactor * b_cofactor;
+                } else {
+                    a.front() = compute_limb_gcd(a.front(), b.front());
+                }
+                break;
+            }
+
+            limb_vector quotient{}, remainder{};
+            detail::divide_magnitudes(a, b, quotient, remainder);
+            if (cofactor != nullptr) {
+                big_integer next_cofactor{a_cofactor - big_integer::from_limbs(std::move(quotient)) * b_cofactor};
+                a_cofactor = std::move(b_cofactor);
+                b_cofactor = std::move(next_cofactor);
+            }
+            a = std::move(b);
+            b = std::move(remainder);
+        }
+
+        if (cofactor != nullptr)
+            *cofactor = std::move(a_cofactor);
+        return a;
+    }
+
+}// namespace
+
+big_integer org::atib::numerics::isqrt(const big_integer &number) {
+    return iroot(number, 2U);
+}
+
+std::pair<big_integer, big_integer> org::atib::numerics::isqrt_rem(const big_integer &number) {
+    if (number.is_nan() || number.is_negative_number())
+        return {big_integer::nan, big_integer::nan};
+
+    limb_vector root{compute_root_magnitude(number.get_limbs(), 2U)};
+    limb_vector remainder{detail::subtract_magnitudes(number.get_limbs(), detail::square_magnitude(root))};
+
+    return {big_integer::from_limbs(std::move(root)), big_integer::from_limbs(std::move(remainder))};
+}
+
+big_integer org::atib::numerics::iroot(const big_integer &number, const std::uint64_t degree) {
+    if (number.is_nan() || 0U == degree || (number.is_negative_number() && 0U == degree % 2))
+        return big_integer::nan;
+
+    return big_integer::from_limbs(compute_root_magnitude(number.get_limbs(), degree), number.is_negative_number());
+}
+
+bool org::atib::numerics::is_perfect_square(const big_integer &number) {
+    if (number.is_nan() || number.is_negative_number())
+        return false;
+
+    const limb_vector &magnitude{number.get_limbs()};
+    if (!is_square_residue(magnitude))
+        return false;
+
+    const limb_vector root{compute_root_magnitude(magnitude, 2U)};
+    return detail::compare_magnitudes(detail::square_magnitude(root), magnitude) == 0;
+}
+
+bool org::atib::numerics::is_perfect_power(const big_integer &number) {
+    if (number.is_nan())
+        return false;
+
+    const limb_vector &magnitude{number.get_limbs()};
+    if (magnitude.size() <= 1U && (magnitude.empty() || 1U == magnitude.front()))
+        return true;
+
+    // a^b has b times as many trailing zero bits as a, so b must divide a non-zero count
+    size_t trailing_zero_bit_count{};
+    while (0U == magnitude[trailing_zero_bit_count / detail::limb_bits])
+        trailing_zero_bit_count += detail::limb_bits;
+    trailing_zero_bit_count += detail::count_trailing_zero_bits(magnitude[trailing_zero_bit_count / detail::limb_bits]);
+
+    if (!number.is_negative_number() && 0U == trailing_zero_bit_count % 2U && is_perfect_square(number))
+        return true;
+
+    // a root of at least 2 bounds the prime exponents by the bit length
+    const size_t bit_count{detail::get_bit_length(magnitude)};
+    std::vector<bool> is_composite(bit_count + 1, false);
+
+    for (size_t degree{3U}; degree < bit_count; degree += 2U) {
+        if (is_composite[degree])
+            continue;
+        for (size_t multiple{degree * degree}; multiple <= bit_count; multiple += 2 * degree)
+            is_composite[multiple] = true;
+
+        if (trailing_zero_bit_count != 0U && trailing_zero_bit_count % degree != 0U)
+            continue;
+
+        if (!is_power_residue(magnitude, degree))
+            continue;
+
+        const limb_vector root{compute_root_magnitude(magnitude, degree)};
+        if (detail::compare_magnitudes(raise_magnitude(root, degree), magnitude) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+big_integer org::atib::numerics::gcd(const big_integer &lhs, const big_integer &rhs) {
+    if (lhs.is_nan() || rhs.is_nan())
+        return big_integer::nan;
+
+    return big_integer::from_limbs(compute_gcd_magnitude(lhs.get_limbs(), rhs.get_limbs(), nullptr));
+}
+
+big_integer org::atib::numerics::lcm(const big_integer &lhs, const big_integer &rhs) {
+    if (lhs.is_nan() || rhs.is_nan())
+        return big_integer::nan;
+
+    if (lhs.is_zero() || rhs.is_zero())
+        return big_integer{};
+
+    return lhs.abs() / gcd(lhs, rhs) * rhs.abs();
+}
+
+std::tuple<big_integer, big_integer, big_integer> org::atib::numerics::extended_gcd(const big_integer &lhs,
+                                                                                     const big_integer &rhs) {
+    if (lhs.is_nan() || rhs.is_nan())
+        return {big_integer::nan, big_integer::nan, big_integer::nan};
+
+    big_integer lhs_cofactor{};
+    big_integer divisor{
+            big_integer::from_limbs(compute_gcd_magnitude(lhs.get_limbs(), rhs.get_limbs(), &lhs_cofactor))};
+
+    if (divisor.is_zero())
+        return {big_integer{}, big_integer{}, big_integer{}};
+
+    if (lhs.is_negative_number())
+        lhs_cofactor = -lhs_cofactor;
+
+    // rhs * t = gcd - lhs * s determines t exactly
+    big_integer rhs_cofactor{rhs.is_zero() ? big_integer{} : (divisor - lhs * lhs_cofactor) / rhs};
+    return {std::move(divisor), std::move(lhs_cofactor), std::move(rhs_cofactor)};
+}
@@ -0,0 +1,547 @@
+#include "../include/primes.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../include/modular_arithmetic.h"
+#include "../include/number_theory.h"
+
+using namespace org::atib::numerics;
+
+namespace {
+
+    using limb_type = detail::limb_type;
+    using limb_vector = detail::limb_vector;
+
+    template<size_t Count>
+    constexpr std::array<limb_type, Count> make_small_prime_table() {
+        std::array<limb_type, Count> primes{};
+        size_t count{};
+
+        for (limb_type candidate{2U}; count < Count; ++candidate) {
+            bool is_prime{true};
+            for (size_t i{}; i < count && primes[i] * primes[i] <= candidate; ++i) {
+                if (0U == candidate % primes[i]) {
+                    is_prime = false;
+                    break;
+                }
+            }
+            if (is_prime)
+                primes[count++] = candidate;
+        }
+
+        return primes;
+    }
+
+    // the 168 primes below 1000
+    constexpr std::array<limb_type, 168> small_primes{make_small_prime_table<168>()};
+
+    // Whether a prime below 1000 divides magnitude, taking one remainder for every batch of primes whose product fits
+    // in a limb.
+    bool has_small_prime_factor(const limb_vector &magnitude) noexcept {
+        for (size_t begin{}; begin < small_primes.size();) {
+            limb_type product{small_primes[begin]};
+            size_t end{begin + 1};
+            while (end < small_primes.size() && product <= std::numeric_limits<limb_type>::max() / small_primes[end])
+                product *= small_primes[end++];
+
+            const limb_type remainder{detail::get_magnitude_remainder(magnitude, product)};
+            for (; begin < end; ++begin) {
+                if (0U == remainder % small_primes[begin])
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    // strong probable prime test of an odd number to base with number - 1 = odd_part * 2^two_exponent
+    bool is_strong_probable_prime_limb(const limb_type number,
+                                       const limb_type base,
+                                       const limb_type odd_part,
+                                       const size_t two_exponent) noexcept {
+        limb_type power{detail::raise_modulo_limb(base, odd_part, number)};
+        if (1U == power || number - 1 == power)
+            return true;
+
+        for (size_t i{1U}; i < two_exponent; ++i) {
+            power = detail::multiply_modulo_limb(power, power, number);
+            if (number - 1 == power)
+                return true;
+            if (1U == power)
+                return false;
+        }
+
+        return false;
+    }
+
+    bool is_prime_limb(const limb_type number) noexcept {
+        if (number < 2U)
+            return false;
+
+        for (const limb_type prime : small_primes) {
+            if (0U == number % prime)
+                return number == prime;
+            if (prime * prime > number)
+                return true;
+        }
+
+        // strong probable primes to these bases are prime below 2^64 (Jim Sinclair's base set)
+        constexpr std::array<limb_type, 7> bases{2U, 325U, 9375U, 28178U, 450775U, 9780504U, 1795265022U};
+        const size_t two_exponent{detail::count_trailing_zero_bits(number - 1)};
+        const limb_type odd_part{(number - 1) >> two_exponent};
+
+        for (const limb_type base : bases) {
+            const limb_type reduced_base{base % number};
+            if (reduced_base != 0U && !is_strong_probable_prime_limb(number, reduced_base, odd_part, two_exponent))
+                return false;
+        }
+
+        return true;
+    }
+
+    // Jacobi symbol (number / modulus) for an odd modulus
+    int compute_jacobi_symbol(limb_type number, limb_type modulus) noexcept {
+        int result{1};
+
+        for (number %= modulus; number != 0U; number %= modulus) {
+            for (; 0U == number % 2U; number /= 2U) {
+                if (3U == modulus % 8U || 5U == modulus % 8U)
+                    result = -result;
+            }
+
+            std::swap(number, modulus);
+            if (3U == number % 4U && 3U == modulus % 4U)
+                result = -result;
+        }
+
+        return 1U == modulus ? result : 0;
+    }
+
+    // Jacobi symbol (number / modulus) for an odd number and an odd modulus of more than one limb, by quadratic
+    // reciprocity
+    int compute_jacobi_symbol(const std::int64_t number, const limb_vector &modulus) noexcept {
+        const limb_type low_limb{modulus.front()};
+        const limb_type magnitude{number < 0 ? 0U - static_cast<limb_type>(number) : static_cast<limb_type>(number)};
+
+        // (-1 / modulus) = -1 exactly for moduli 3 mod 4, and (a / m) = -(m / a) exactly when both are 3 mod 4
+        int result{number < 0 && 3U == low_limb % 4U ? -1 : 1};
+        if (3U == magnitude % 4U && 3U == low_limb % 4U)
+            result = -result;
+
+        return result * compute_jacobi_symbol(detail::get_magnitude_remainder(modulus, magnitude), magnitude);
+    }
+
+    size_t count_trailing_zero_bits(const limb_vector &magnitude) noexcept {
+        size_t limb_index{};
+        while (0U == magnitude[limb_index])
+            ++limb_index;
+        return limb_index * detail::limb_bits + detail::count_trailing_zero_bits(magnitude[limb_index]);
+    }
+
+    // arithmetic on numbers in [0, modulus), in or out of Montgomery form alike
+    big_integer add_modulo(const big_integer &lhs, const big_integer &rhs, const big_integer &modulus) {
+        big_integer sum{lhs + rhs};
+        if (sum >= modulus)
+            sum -= modulus;
+        return sum;
+    }
+
+    big_integer subtract_modulo(const big_integer &lhs, const big_integer &rhs, const big_integer &modulus) {
+        big_integer difference{lhs - rhs};
+        if (difference.is_negative_number())
+            difference += modulus;
+        return difference;
+    }
+
+    big_integer halve_modulo(const big_integer &number, const big_integer &modulus) {
+        const bool is_odd{!number.is_zero() && (number.get_limbs().front() & 1U) != 0U};
+        return is_odd ? (number + modulus) >> 1U : number >> 1U;
+    }
+
+    bool is_strong_probable_prime(const montgomery_context &context,
+                                  const big_integer &base,
+                                  const big_integer &odd_part,
+                                  const size_t two_exponent,
+                                  const big_integer &one,
+                                  const big_integer &minus_one) {
+        big_integer power{context.to_montgomery(context.pow(base, odd_part))};
+        if (power == one || power == minus_one)
+            return true;
+
+        for (size_t i{1U}; i < two_exponent; ++i) {
+            power = context.square(power);
+            if (power == minus_one)
+                return true;
+            if (power == one)
+                return false;
+        }
+
+        return false;
+    }
+
+    // Strong Lucas probable prime test of a number that is not a perfect square, with P = 1 and Q = (1 - D) / 4 for the
+    // first D in 5, -7, 9, -11, ... with Jacobi symbol (D / number) = -1. With number + 1 = odd_part * 2^s it checks
+    // U(odd_part) = 0 or V(odd_part * 2^r) = 0 for some r < s, running the sequences in Montgomery form.
+    bool is_strong_lucas_probable_prime(const montgomery_context &context, const big_integer &number) {
+        std::int64_t discriminant{5};
+        for (;; discriminant = discriminant > 0 ? -(discriminant + 2) : 2 - discriminant) {
+            const int jacobi_symbol{compute_jacobi_symbol(discriminant, number.get_limbs())};
+            if (-1 == jacobi_symbol)
+                break;
+            // number is larger than |D|, so a common factor makes it composite
+            if (0 == jacobi_symbol)
+                return false;
+        }
+
+        const big_integer discriminant_form{context.to_montgomery(big_integer{discriminant})};
+        const big_integer q_form{context.to_montgomery(big_integer{(1 - discriminant) / 4})};
+
+        const big_integer successor{number + big_integer::plus_one};
+        const size_t two_exponent{count_trailing_zero_bits(successor.get_limbs())};
+        const big_integer odd_part{successor >> two_exponent};
+        const limb_vector &odd_part_limbs{odd_part.get_limbs()};
+
+        // U(1) = 1, V(1) = P = 1 and Q^1, doubled by U(2k) = U(k) * V(k), V(2k) = V(k)^2 - 2 * Q^k and incremented by
+        // U(k + 1) = (P * U(k) + V(k)) / 2, V(k + 1) = (D * U(k) + P * V(k)) / 2
+        big_integer u{context.to_montgomery(big_integer::plus_one)}, v{u}, q_power{q_form};
+        for (size_t i{detail::get_bit_length(odd_part_limbs) - 1}; i > 0U; --i) {
+            u = context.mul(u, v);
+            v = subtract_modulo(context.square(v), add_modulo(q_power, q_power, number), number);
+            q_power = context.square(q_power);
+
+            if (((odd_part_limbs[(i - 1) / detail::limb_bits] >> ((i - 1) % detail::limb_bits)) & 1U) != 0U) {
+                big_integer next_u{halve_modulo(add_modulo(u, v, number), number)};
+                v = halve_modulo(add_modulo(context.mul(discriminant_form, u), v, number), number);
+                u = std::move(next_u);
+                q_power = context.mul(q_power, q_form);
+            }
+        }
+
+        if (u.is_zero() || v.is_zero())
+            return true;
+
+        for (size_t r{1U}; r < two_exponent; ++r) {
+            v = subtract_modulo(context.square(v), add_modulo(q_power, q_power, number), number);
+            if (v.is_zero())
+                return true;
+            q_power = context.square(q_power);
+        }
+
+        return false;
+    }
+
+    // Baillie-PSW and rounds further Miller-Rabin tests of an odd number without prime factors below 1000
+    bool is_baillie_psw_probable_prime(const big_integer &number, const size_t rounds) {
+        const limb_vector &magnitude{number.get_limbs()};
+        const montgomery_context context{number};
+        const big_integer predecessor{number - big_integer::plus_one};
+        const big_integer one{context.to_montgomery(big_integer::plus_one)};
+        const big_integer minus_one{context.to_montgomery(predecessor)};
+
+        const size_t two_exponent{count_trailing_zero_bits(predecessor.get_limbs())};
+        const big_integer odd_part{predecessor >> two_exponent};
+
+        if (!is_strong_probable_prime(context, big_integer{2}, odd_part, two_exponent, one, minus_one))
+            return false;
+
+        if (is_perfect_square(number) || !is_strong_lucas_probable_prime(context, number))
+            return false;
+
+        // bases in [2, number - 2]
+        std::mt19937_64 generator{magnitude.front() ^ magnitude.back()};
+        const big_integer base_range{number - big_integer{3}};
+
+        for (size_t i{}; i < rounds; ++i) {
+            limb_vector base_limbs(magnitude.size());
+            for (limb_type &limb : base_limbs)
+                limb = generator();
+
+            const big_integer base{big_integer::from_limbs(std::move(base_limbs)) % base_range + big_integer{2}};
+            if (!is_strong_probable_prime(context, base, odd_part, two_exponent, one, minus_one))
+                return false;
+        }
+
+        return true;
+    }
+
+    // The odd primes below 2^16, sieved once
+    const std::vector<limb_type> &get_sieving_primes() {
+        static const std::vector<limb_type> primes{[] {
+            constexpr size_t limit{size_t{1} << 16U};
+            std::vector<bool> is_composite(limit, false);
+            std::vector<limb_type> odd_primes{};
+
+            for (size_t i{3U}; i < limit; i += 2U) {
+                if (is_composite[i])
+                    continue;
+                odd_primes.emplace_back(i);
+                for (size_t multiple{i * i}; multiple < limit; multiple += 2 * i)
+                    is_composite[multiple] = true;
+            }
+
+            return odd_primes;
+        }()};
+
+        return primes;
+    }
+
+    // number mod each of the first count sieving primes, one pass over number for every batch of primes whose product
+    // fits in a limb
+    std::vector<limb_type> compute_residues(const limb_vector &number, const size_t count) {
+        const std::vector<limb_type> &primes{get_sieving_primes()};
+        std::vector<limb_type> residues(count);
+
+        for (size_t begin{}; begin < count;) {
+            limb_type product{primes[begin]};
+            size_t end{begin + 1};
+            while (end < count && product <= std::numeric_limits<limb_type>::max() / primes[end])
+                product *= primes[end++];
+
+            const limb_type remainder{detail::get_magnitude_remainder(number, product)};
+            for (; begin < end; ++begin)
+                residues[begin] = remainder % primes[begin];
+        }
+
+        return residues;
+    }
+
+    // Marks the odd candidates base + 2 * i for i < is_composite.size() that a sieving prime divides, given the
+    // residues of base. base must be larger than the sieving primes.
+    void sieve_candidates(const std::vector<limb_type> &residues, std::vector<bool> &is_composite) {
+        const std::vector<limb_type> &primes{get_sieving_primes()};
+        std::fill(is_composite.begin(), is_composite.end(), false);
+
+        for (size_t k{}; k < residues.size(); ++k) {
+            const limb_type prime{primes[k]};
+            // base + 2 * i = 0 mod prime for i = -base / 2 = (prime - residue) * (prime + 1) / 2 mod prime
+            const limb_type first{(prime - residues[k]) % prime * ((prime + 1) / 2) % prime};
+            for (size_t i{first}; i < is_composite.size(); i += prime)
+                is_composite[i] = true;
+        }
+    }
+
+    // residues of base +- distance from those of base
+    void shift_residues(std::vector<limb_type> &residues, const limb_type distance, const bool is_downward) {
+        const std::vector<limb_type> &primes{get_sieving_primes()};
+
+        for (size_t k{}; k < residues.size(); ++k) {
+            const limb_type prime{primes[k]}, step{distance % prime};
+            residues[k] = is_downward ? (residues[k] + prime - step) % prime : (residues[k] + step) % prime;
+        }
+    }
+
+    bool is_odd(const big_integer &number) noexcept {
+        return !number.is_zero() && (number.get_limbs().front() & 1U) != 0U;
+    }
+
+    size_t get_sieving_prime_count(const size_t bit_count) {
+        // sieving primes pay off as long as computing their residues is cheaper than the tests they save
+        return std::min<size_t>(get_sieving_primes().size(), BIG_INTEGER_PRIME_SIEVE_PRIME_FACTOR * bit_count);
+    }
+
+    // A window of the odd candidates base + 2 * i for i < is_composite.size(), with base modulo the first sieving
+    // primes. Every worker of a parallel search owns one.
+    struct sieve_segment {
+        big_integer base;
+        std::vector<limb_type> residues;
+        std::vector<bool> is_composite;
+    };
+
+    // The window offset windows after the one whose first (upwards) or last (downwards) candidate is start
+    sieve_segment make_sieve_segment(const big_integer &start,
+                                     const size_t window_size,
+                                     const size_t prime_count,
+                                     const size_t offset,
+                                     const bool is_downward) {
+        const big_integer distance{limb_type{2 * window_size * offset}};
+        big_integer base{is_downward ? start - big_integer{limb_type{2 * (window_size - 1)}} - distance
+                                     : start + distance};
+        std::vector<limb_type> residues{compute_residues(base.get_limbs(), prime_count)};
+
+        return {std::move(base), std::move(residues), std::vector<bool>(window_size)};
+    }
+
+    // moves the segment window_count windows on in search direction
+    void advance_sieve_segment(sieve_segment &segment, const size_t window_count, const bool is_downward) {
+        const limb_type distance{2 * segment.is_composite.size() * window_count};
+        segment.base = is_downward ? segment.base - big_integer{distance} : segment.base + big_integer{distance};
+        shift_residues(segment.residues, distance, is_downward);
+    }
+
+    // The first probable prime of the segment in search direction, NaN if there is none or the search is cancelled
+    // before it is found.
+    template<typename Predicate>
+    big_integer find_prime_in_segment(sieve_segment &segment, const bool is_downward, const Predicate &is_cancelled) {
+        const size_t window_size{segment.is_composite.size()};
+        sieve_candidates(segment.residues, segment.is_composite);
+
+        for (size_t j{}; j < window_size; ++j) {
+            const size_t i{is_downward ? window_size - 1 - j : j};
+            if (segment.is_composite[i])
+                continue;
+            if (is_cancelled())
+                break;
+
+            big_integer candidate{segment.base + big_integer{limb_type{2 * i}}};
+            if (1U == candidate.get_limbs().size() ? is_prime_limb(candidate.get_limbs().front())
+                                                   : is_baillie_psw_probable_prime(candidate, 0U))
+                return candidate;
+        }
+
+        return big_integer::nan;
+    }
+
+    // The first probable prime among the odd numbers from an odd start of more than one limb on, upwards or
+    // downwards. The candidates are sieved in windows, the residues of the next window following from those of the
+    // current one.
+    big_integer find_prime_by_sieve(const big_integer &start, const bool is_downward) {
+        // a window spans many prime gaps of about 0.35 * bit_count odd numbers
+        const size_t bit_count{detail::get_bit_length(start.get_limbs())};
+        const size_t window_size{std::max<size_t>(BIG_INTEGER_PRIME_SIEVE_WINDOW_FACTOR * bit_count, 1024U)};
+        sieve_segment segment{
+                make_sieve_segment(start, window_size, get_sieving_prime_count(bit_count), 0U, is_downward)};
+
+        for (;;) {
+            const big_integer prime{find_prime_in_segment(segment, is_downward, []() { return false; })};
+            if (!prime.is_nan())
+                return prime;
+
+            advance_sieve_segment(segment, 1U, is_downward);
+        }
+    }
+
+    // find_prime_by_sieve() by thread_count workers, worker w searching the windows w, w + thread_count, ... A worker
+    // stops once a window before its current one is known to hold a prime, windows before the first such one are
+    // searched to the end. The result thus does not depend on scheduling.
+    big_integer find_prime_by_parallel_sieve(const big_integer &start,
+                                             const bool is_downward,
+                                             const size_t thread_count) {
+        // the workers cover about three average prime gaps per round together
+        const size_t bit_count{detail::get_bit_length(start.get_limbs())};
+        const size_t window_size{std::max<size_t>(bit_count / thread_count, 64U)};
+        const size_t prime_count{get_sieving_prime_count(bit_count)};
+
+        std::atomic<size_t> first_window{std::numeric_limits<size_t>::max()};
+        std::vector<big_integer> primes(thread_count);
+        std::vector<std::thread> workers{};
+        workers.reserve(thread_count);
+
+        for (size_t worker{}; worker < thread_count; ++worker) {
+            workers.emplace_back([&, worker]() {
+                sieve_segment segment{make_sieve_segment(start, window_size, prime_count, worker, is_downward)};
+
+                for (size_t window{worker}; window < first_window.load(); window += thread_count) {
+                    const big_integer prime{find_prime_in_segment(
+                            segment, is_downward, [&]() { return first_window.load() < window; })};
+
+                    if (!prime.is_nan()) {
+                        primes[worker] = prime;
+                        size_t expected{first_window.load()};
+                        while (window < expected && !first_window.compare_exchange_weak(expected, window)) {
+                        }
+                        return;
+                    }
+
+                    advance_sieve_segment(segment, thread_count, is_downward);
+                }
+            });
+        }
+
+        for (std::thread &worker : workers)
+            worker.join();
+
+        return primes[first_window.load() % thread_count];
+    }
+
+    big_integer find_prime(const big_integer &start, const bool is_downward, const size_t thread_count) {
+        const size_t worker_count{0U == thread_count ? std::max(std::thread::hardware_concurrency(), 1U)
+                                                     : thread_count};
+        return 1U == worker_count ? find_prime_by_sieve(start, is_downward)
+                                  : find_prime_by_parallel_sieve(start, is_downward, worker_count);
+    }
+
+}// namespace
+
+bool org::atib::numerics::is_probable_prime(const big_integer &number, const size_t rounds) {
+    if (number.is_nan() || number.is_negative_number() || number.is_zero())
+        return false;
+
+    const limb_vector &magnitude{number.get_limbs()};
+    if (1U == magnitude.size())
+        return is_prime_limb(magnitude.front());
+
+    return !has_small_prime_factor(magnitude) && is_baillie_psw_probable_prime(number, rounds);
+}
+
+big_integer org::atib::numerics::next_prime(const big_integer &number, const size_t thread_count) {
+    if (number.is_nan())
+        return big_integer::nan;
+
+    if (number < big_integer{2})
+        return big_integer{2};
+
+    big_integer start{number + big_integer::plus_one};
+    if (!is_odd(start))
+        start += big_integer::plus_one;
+
+    if (1U == start.get_limbs().size()) {
+        // single limbs are tested one by one until the candidates wrap around past 2^64
+        for (limb_type candidate{start.get_limbs().front()}; candidate > 2U; candidate += 2U) {
+            if (is_prime_limb(candidate))
+                return big_integer{candidate};
+        }
+        start = (big_integer::plus_one << detail::limb_bits) + big_integer::plus_one;
+    }
+
+    return find_prime(start, false, thread_count);
+}
+
+big_integer org::atib::numerics::prev_prime(const big_integer &number, const size_t thread_count) {
+    if (number.is_nan() || number <= big_integer{2})
+        return big_integer::nan;
+
+    if (number == big_integer{3})
+        return big_integer{2};
+
+    big_integer start{number - big_integer::plus_one};
+    if (!is_odd(start))
+        start -= big_integer::plus_one;
+
+    if (1U == start.get_limbs().size()) {
+        for (limb_type candidate{start.get_limbs().front()};; candidate -= 2U) {
+            if (is_prime_limb(candidate))
+                return big_integer{candidate};
+        }
+    }
+
+    return find_prime(start, true, thread_count);
+}
+
+big_integer org::atib::numerics::random_prime(const size_t bit_count,
+                                              std::mt19937_64 &generator,
+                                              const size_t thread_count) {
+    if (bit_count < 2U)
+        return big_integer::nan;
+
+    const size_t top_bit{(bit_count - 1) % detail::limb_bits};
+
+    for (;;) {
+        limb_vector limbs((bit_count + detail::limb_bits - 1) / detail::limb_bits);
+        for (limb_type &limb : limbs)
+            limb = generator();
+        limbs.back() &= (limb_type{2} << top_bit) - 1U;
+        limbs.back() |= limb_type{1} << top_bit;
+
+        // the first prime from the random number on, drawn again when it has outgrown bit_count bits
+        const big_integer prime{
+                next_prime(big_integer::from_limbs(std::move(limbs), false) - big_integer::plus_one, thread_count)};
+        if (detail::get_bit_length(prime.get_limbs()) == bit_count)
+            return prime;
+    }
+}
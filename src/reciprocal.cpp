@@ -0,0 +1,154 @@
+#include "../include/reciprocal.h"
+
+using namespace org::atib::numerics;
+
+reciprocal::reciprocal(const big_integer &divisor) : divisor_{divisor} {
+    if (divisor_.is_nan() || divisor_.is_zero()) {
+#ifndef BIG_INTEGER_NO_THROW
+        if (divisor_.is_zero())
+            throw division_by_zero_error{};
+#endif
+        divisor_ = big_integer::nan;
+        return;
+    }
+
+    const std::vector<limb_type> &divisor_limbs{divisor_.get_limbs()};
+    if (divisor_limbs.size() >= BIG_INTEGER_RECIPROCAL_THRESHOLD) {
+        normalization_shift_ = detail::count_leading_zero_bits(divisor_limbs.back());
+        normalized_divisor_ = detail::shift_magnitude_left(divisor_limbs, normalization_shift_);
+        inverse_ = compute_inverse(normalized_divisor_, normalized_divisor_.size()).get_limbs();
+    }
+}
+
+const big_integer &reciprocal::get_divisor() const noexcept {
+    return divisor_;
+}
+
+void reciprocal::divmod(const big_integer &dividend, big_integer &quotient, big_integer &remainder) const {
+    if (dividend.is_nan() || divisor_.is_nan()) {
+        quotient = big_integer::nan;
+        remainder = big_integer::nan;
+        return;
+    }
+
+    std::vector<limb_type> quotient_limbs{}, remainder_limbs{};
+    divide_magnitude(dividend.get_limbs(), quotient_limbs, remainder_limbs);
+
+    const bool is_negative_quotient{dividend.is_negative_number() != divisor_.is_negative_number()};
+    const bool is_negative_remainder{dividend.is_negative_number()};
+
+    quotient = big_integer::from_limbs(std::move(quotient_limbs), is_negative_quotient);
+    remainder = big_integer::from_limbs(std::move(remainder_limbs), is_negative_remainder);
+}
+
+big_integer reciprocal::divide(const big_integer &dividend) const {
+    big_integer quotient{}, remainder{};
+    divmod(dividend, quotient, remainder);
+    return quotient;
+}
+
+big_integer reciprocal::remainder(const big_integer &dividend) const {
+    big_integer quotient{}, remainder{};
+    divmod(dividend, quotient, remainder);
+    return remainder;
+}
+
+void reciprocal::divide_magnitude(const std::vector<limb_type> &dividend,
+                                  std::vector<limb_type> &quotient,
+                                  std::vector<limb_type> &remainder) const {
+    if (inverse_.empty()) {
+        detail::divide_magnitudes(dividend, divisor_.get_limbs(), quotient, remainder);
+        return;
+    }
+
+    // the quotient by the normalized divisor is unchanged when the dividend is shifted by the same amount
+    const std::vector<limb_type> shifted_dividend{detail::shift_magnitude_left(dividend, normalization_shift_)};
+    const size_t block_size{normalized_divisor_.size()};
+
+    quotient.assign(shifted_dividend.size(), 0U);
+    remainder.clear();
+
+    // every block is the previous remainder followed by the next block_size limbs of the dividend, thus less than
+    // divisor * B^block_size
+    for (size_t offset{(shifted_dividend.size() + block_size - 1) / block_size * block_size}; offset > 0U;) {
+        offset -= block_size;
+
+        std::vector<limb_type> block(block_size + remainder.size(), 0U);
+        std::copy(shifted_dividend.cbegin() + offset,
+                  shifted_dividend.cbegin() + std::min(shifted_dividend.size(), offset + block_size),
+                  block.begin());
+        std::copy(remainder.cbegin(), remainder.cend(), block.begin() + block_size);
+        detail::trim_leading_zero_limbs(block);
+
+        std::vector<limb_type> block_quotient{};
+        divide_block(block, block_quotient);
+        std::copy(block_quotient.cbegin(), block_quotient.cend(), quotient.begin() + offset);
+        remainder = std::move(block);
+    }
+
+    detail::trim_leading_zero_limbs(quotient);
+    remainder = detail::shift_magnitude_right(remainder, normalization_shift_);
+}
+
+void reciprocal::divide_block(std::vector<limb_type> &block, std::vector<limb_type> &quotient) const {
+    const std::vector<limb_type> &divisor{normalized_divisor_};
+    const size_t block_size{divisor.size()};
+
+    // floor(floor(block / B^(n - 1)) * inverse / B^(n + 1)) is at most two less than the quotient
+    quotient.clear();
+
+    if (block.size() >= block_size) {
+        const std::vector<limb_type> block_high(block.cbegin() + (block_size - 1), block.cend());
+        const std::vector<limb_type> product{detail::multiply_magnitudes(block_high, inverse_)};
+
+        if (product.size() > block_size + 1)
+            quotient.assign(product.cbegin() + (block_size + 1), product.cend());
+
+        block = detail::subtract_magnitudes(block, detail::multiply_magnitudes(quotient, divisor));
+    }
+
+    while (detail::compare_magnitudes(block, divisor) >= 0) {
+        block = detail::subtract_magnitudes(block, divisor);
+        quotient = detail::add_magnitudes(quotient, {1U});
+    }
+}
+
+big_integer reciprocal::compute_inverse(const std::vector<limb_type> &divisor, const size_t size) {
+    // floor(B^(2 * size) / top) where top consists of the size most significant limbs of the divisor
+    const big_integer top{big_integer::from_limbs({divisor.cend() - size, divisor.cend()})};
+    const size_t power_bit_count{2 * size * detail::limb_bits};
+    const big_integer power{big_integer::plus_one << power_bit_count};
+
+    if (size <= BIG_INTEGER_RECIPROCAL_NEWTON_THRESHOLD)
+        return power / top;
+
+    // the inverse at half the precision shifted into place is the starting point of one Newton step
+    // x + x * (B^(2 * size) - top * x) / B^(2 * size)
+    const size_t half{(size + 1) / 2};
+    big_integer inverse{compute_inverse(divisor, half) << ((size - half) * detail::limb_bits)};
+    big_integer error{power - top * inverse};
+    const big_integer correction{(inverse * error.abs()) >> power_bit_count};
+
+    inverse = error.is_negative_number() ? inverse - correction - big_integer::plus_one : inverse + correction;
+    error = power - top * inverse;
+
+    while (error.is_negative_number()) {
+        inverse -= big_integer::plus_one;
+        error += top;
+    }
+
+    while (error >= top) {
+        inverse += big_integer::plus_one;
+        error -= top;
+    }
+
+    return inverse;
+}
+
+big_integer org::atib::numerics::operator/(const big_integer &dividend, const reciprocal &divisor) {
+    return divisor.divide(dividend);
+}
+
+big_integer org::atib::numerics::operator%(const big_integer &dividend, const reciprocal &divisor) {
+    return divisor.remainder(dividend);
+}
@@ -1,6 +1,11 @@
 #define CATCH_CONFIG_MAIN
 
 #include "../include/big_integer.h"
+#include "../include/combinatorics.h"
+#include "../include/modular_arithmetic.h"
+#include "../include/number_theory.h"
+#include "../include/primes.h"
+#include "../include/reciprocal.h"
 #include "../include/catch.hpp"
 
 #if defined(_MSC_VER)
@@ -20,6 +25,7 @@
 #include <limits>
 #include <random>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 using namespace std;
@@ -1439,3 +1445,847 @@ TEST_CASE("std::istream& operator>>(std::istream&, big_integer&)",
         REQUIRE(random_number_str == bi.get_decimal_number());
     }
 }
+
+TEST_CASE("static big_integer from_limbs(std::vector<limb_type>, const bool), "
+          "const std::vector<limb_type>& get_limbs() const noexcept",
+          "Testing the 64-bit limb representation of big_integer's magnitude") {
+    const big_integer two_to_the_power_of_128{"340282366920938463463374607431768211456"};
+    const std::vector<big_integer::limb_type> expected_limbs{0U, 0U, 1U};
+    REQUIRE(two_to_the_power_of_128.get_limbs() == expected_limbs);
+    REQUIRE(big_integer::from_limbs({0U, 0U, 1U}) == two_to_the_power_of_128);
+    REQUIRE(two_to_the_power_of_128.get_hexadecimal_number() == "0x100000000000000000000000000000000");
+
+    const big_integer max_limb_value{std::numeric_limits<uint64_t>::max()};
+    const big_integer max_limb_value_squared{max_limb_value * max_limb_value};
+    REQUIRE(max_limb_value_squared.get_decimal_number() == "340282366920938463426481119284349108225");
+    REQUIRE((max_limb_value_squared + max_limb_value + max_limb_value + big_integer::plus_one) ==
+            two_to_the_power_of_128);
+    const std::vector<big_integer::limb_type> expected_max_limbs(2U, std::numeric_limits<uint64_t>::max());
+    REQUIRE((two_to_the_power_of_128 - big_integer::plus_one).get_limbs() == expected_max_limbs);
+
+    const big_integer negative_number{big_integer::from_limbs({5U, 0U, 0U}, true)};
+    REQUIRE(negative_number.get_limbs().size() == 1U);
+    REQUIRE(negative_number.get_decimal_number() == "-5");
+    REQUIRE(negative_number.get_decimal_digits() == std::vector<int>(1U, -5));
+    REQUIRE(big_integer::from_limbs({}, true) == big_integer::zero);
+    REQUIRE(!big_integer::from_limbs({}, true).is_negative_number());
+
+    for (size_t i{}; i < number_of_tests; ++i) {
+        const uint64_t random_number{get_random_positive_number()};
+        const big_integer bi{random_number};
+        const std::vector<big_integer::limb_type> expected_single_limb{random_number};
+        REQUIRE(bi.get_limbs() == expected_single_limb);
+        REQUIRE(bi.get_decimal_number() == std::to_string(random_number));
+    }
+}
+
+TEST_CASE("Lazily created string representations",
+          "Testing that big_integer's string representations are created on first use "
+          "and safely published when a const object is shared between threads") {
+    const big_integer addend{"123456789012345678901234567890"};
+    big_integer sum{};
+
+    for (size_t i{}; i < 1000U; ++i)
+        sum += addend;
+
+    REQUIRE(sum.get_decimal_number() == "123456789012345678901234567890000");
+
+    const big_integer shared_number{sum * sum};
+    const std::string expected_decimal_number{
+            "15241578753238836750495351562536198787501905199875019052100000000"};
+    const std::string expected_hexadecimal_number{"0x250CDB951C93C4AD4FE17F555D6461C750784FA2AB565F0B7A9900"};
+
+    static constexpr const size_t number_of_threads{4U};
+    std::vector<std::string> decimal_numbers(number_of_threads);
+    std::vector<std::string> hexadecimal_numbers(number_of_threads);
+    std::vector<const char *> decimal_number_pointers(number_of_threads);
+    std::vector<std::thread> threads{};
+
+    for (size_t i{}; i < number_of_threads; ++i) {
+        threads.emplace_back([&, i]() {
+            decimal_numbers[i] = shared_number.get_decimal_number();
+            hexadecimal_numbers[i] = shared_number.get_hexadecimal_number();
+            decimal_number_pointers[i] = static_cast<const char *>(shared_number);
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    for (size_t i{}; i < number_of_threads; ++i) {
+        REQUIRE(decimal_numbers[i] == expected_decimal_number);
+        REQUIRE(hexadecimal_numbers[i] == expected_hexadecimal_number);
+        REQUIRE(decimal_number_pointers[i] == decimal_number_pointers.front());
+    }
+
+    big_integer negated_number{shared_number};
+    REQUIRE(negated_number.get_decimal_number() == expected_decimal_number);
+    negated_number.invert_sign();
+    REQUIRE(negated_number.get_decimal_number() == "-" + expected_decimal_number);
+    REQUIRE(negated_number.get_hexadecimal_number() == "-" + expected_hexadecimal_number);
+    REQUIRE(shared_number.get_decimal_number() == expected_decimal_number);
+}
+
+TEST_CASE("Conversion of long decimal numbers to binary representation",
+          "Testing divide-and-conquer conversion of decimal input numbers") {
+    const std::string nines(5000U, '9');
+    const big_integer all_nines{nines};
+    REQUIRE(all_nines.get_decimal_number() == nines);
+    const big_integer one{1};
+    const big_integer ten{10};
+    REQUIRE(all_nines + one == big_integer{"1" + std::string(5000U, '0')});
+
+    big_integer power_of_ten{one};
+    for (size_t i{}; i < 5000U; ++i)
+        power_of_ten *= ten;
+    REQUIRE(all_nines == power_of_ten - one);
+
+    std::string digits{"-7"};
+    for (size_t i{}; i < 3000U; ++i)
+        digits += static_cast<char>('0' + (i * 7U + i / 13U) % 10U);
+    const big_integer negative_number{digits};
+    REQUIRE(negative_number.get_decimal_number() == digits);
+    REQUIRE(big_integer{negative_number.get_hexadecimal_number()} == negative_number);
+}
+
+TEST_CASE("Conversion of long binary numbers to decimal representation",
+          "Testing divide-and-conquer conversion of hexadecimal input numbers to decimal output") {
+    const big_integer power_of_two{"0x1" + std::string(2000U, '0')};
+    const big_integer one{1};
+    const big_integer two{2};
+
+    big_integer expected_power_of_two{one};
+    for (size_t i{}; i < 8000U; ++i)
+        expected_power_of_two *= two;
+
+    REQUIRE(power_of_two == expected_power_of_two);
+
+    const std::string decimal_number{power_of_two.get_decimal_number()};
+    REQUIRE(decimal_number.length() == 2409U);
+    REQUIRE(decimal_number.substr(0U, 20U) == "17376620319380945659");
+    REQUIRE(decimal_number.substr(decimal_number.length() - 20U) == "29880747677634789376");
+    REQUIRE(big_integer{decimal_number} == power_of_two);
+
+    const std::string nines(3000U, '9');
+    const big_integer almost_power_of_ten{big_integer{"1" + std::string(3000U, '0')} - one};
+    REQUIRE(big_integer{almost_power_of_ten.get_hexadecimal_number()}.get_decimal_number() == nines);
+    REQUIRE((-almost_power_of_ten).get_decimal_number() == "-" + nines);
+}
+
+TEST_CASE("Multiplication of long numbers",
+          "Testing Karatsuba multiplication of operands above BIG_INTEGER_KARATSUBA_THRESHOLD limbs") {
+    const big_integer one{1};
+    const big_integer all_ones{"0x" + std::string(1024U, 'F')};
+    const big_integer power_of_two{all_ones + one};
+
+    REQUIRE(all_ones * all_ones == power_of_two * power_of_two - power_of_two - power_of_two + one);
+    REQUIRE((all_ones * all_ones).get_hexadecimal_number() ==
+            "0x" + std::string(1023U, 'F') + "E" + std::string(1023U, '0') + "1");
+
+    const big_integer almost_power_of_ten{big_integer{"1" + std::string(3000U, '0')} - one};
+    REQUIRE(almost_power_of_ten * (almost_power_of_ten + one + one) ==
+            big_integer{"1" + std::string(6000U, '0')} - one);
+
+    std::string first_digits{"-9"}, second_digits{"8"}, third_digits{"7"};
+    for (size_t i{}; i < 4000U; ++i) {
+        first_digits += static_cast<char>('0' + (i * 7U + i / 11U) % 10U);
+        if (i < 1500U)
+            second_digits += static_cast<char>('0' + (i * 3U + i / 7U) % 10U);
+        if (i < 2500U)
+            third_digits += static_cast<char>('0' + (i * 9U + i / 5U) % 10U);
+    }
+
+    const big_integer first{first_digits}, second{second_digits}, third{third_digits};
+    REQUIRE(first * (second + third) == first * second + first * third);
+    REQUIRE((first * second) * third == first * (second * third));
+    REQUIRE(first * second == second * first);
+    REQUIRE((first * second) / second == first);
+}
+
+// Hexadecimal digit string whose i-th digit is (i * multiplier + i / divisor + offset) mod 16, an irregular pattern
+// that reproduces the same long operands on every run.
+static std::string patterned_hexadecimal_number(const size_t digit_count,
+                                                const size_t multiplier,
+                                                const size_t divisor,
+                                                const size_t offset,
+                                                const bool is_negative) {
+    std::string number{is_negative ? "-0x" : "0x"};
+    for (size_t i{}; i < digit_count; ++i)
+        number += number_base_digits[(i * multiplier + i / divisor + offset) % 16U];
+    return number;
+}
+
+TEST_CASE("Multiplication of unbalanced numbers",
+          "Testing long operands multiplied by much shorter ones one block of the shorter length at a time") {
+    static constexpr const size_t long_limb_count{20000U};
+
+    const big_integer one{1};
+    const big_integer long_ones{"0x" + std::string(16U * long_limb_count, 'F')};
+
+    for (const size_t short_limb_count :
+         {size_t{BIG_INTEGER_KARATSUBA_THRESHOLD}, size_t{BIG_INTEGER_KARATSUBA_THRESHOLD + 1U}, size_t{100U}}) {
+        // every block product carries into the limbs of the next block
+        const big_integer short_ones{"0x" + std::string(16U * short_limb_count, 'F')};
+        REQUIRE(long_ones * short_ones == (long_ones << (64U * short_limb_count)) - long_ones);
+
+        const big_integer short_number{patterned_hexadecimal_number(16U * short_limb_count, 5U, 3U, 1U, true)};
+        const size_t split_bit_count{64U * (long_limb_count / 2U) + 17U};
+        const big_integer low{long_ones - ((long_ones >> split_bit_count) << split_bit_count)};
+        REQUIRE(long_ones * short_number ==
+                (((long_ones >> split_bit_count) * short_number) << split_bit_count) + low * short_number);
+        REQUIRE(short_number * long_ones == long_ones * short_number);
+    }
+}
+
+TEST_CASE("Multiplication of very long numbers",
+          "Testing Toom-3 and Toom-4 multiplication of operands above BIG_INTEGER_TOOM3_THRESHOLD limbs") {
+    const big_integer one{1};
+
+    for (const size_t hexadecimal_digit_count : {8000U, 16000U}) {
+        const big_integer all_ones{"0x" + std::string(hexadecimal_digit_count, 'F')};
+        REQUIRE((all_ones * all_ones).get_hexadecimal_number() ==
+                "0x" + std::string(hexadecimal_digit_count - 1, 'F') + "E" +
+                std::string(hexadecimal_digit_count - 1, '0') + "1");
+
+        const big_integer first{patterned_hexadecimal_number(hexadecimal_digit_count, 7U, 17U, 1U, false)};
+        const big_integer second{patterned_hexadecimal_number(hexadecimal_digit_count, 5U, 3U, 1U, true)};
+        const big_integer product{first * second};
+        REQUIRE(product == second * first);
+        REQUIRE(product + first == first * (second + one));
+        REQUIRE(product - second == (first - one) * second);
+    }
+}
+
+TEST_CASE("Multiplication of huge numbers",
+          "Testing NTT multiplication of operands above BIG_INTEGER_NTT_THRESHOLD limbs") {
+    static constexpr const size_t hexadecimal_digit_count{16U * (BIG_INTEGER_NTT_THRESHOLD + 100U)};
+
+    const big_integer all_ones{"0x" + std::string(hexadecimal_digit_count, 'F')};
+    REQUIRE((all_ones * all_ones).get_hexadecimal_number() ==
+            "0x" + std::string(hexadecimal_digit_count - 1, 'F') + "E" +
+            std::string(hexadecimal_digit_count - 1, '0') + "1");
+
+    const big_integer first{patterned_hexadecimal_number(hexadecimal_digit_count, 7U, 17U, 1U, false)};
+    const big_integer second{patterned_hexadecimal_number(hexadecimal_digit_count, 5U, 3U, 1U, true)};
+
+    // both halves of first are shorter than BIG_INTEGER_NTT_THRESHOLD limbs, so that their products with second are
+    // computed block by block by Toom-4 instead of by the transform under test
+    const size_t split_bit_count{64U * ((BIG_INTEGER_NTT_THRESHOLD + 100U) / 2U) + 17U};
+    const big_integer high{first >> split_bit_count};
+    const big_integer low{first - (high << split_bit_count)};
+    REQUIRE(high.get_limbs().size() < BIG_INTEGER_NTT_THRESHOLD);
+    REQUIRE(low.get_limbs().size() < BIG_INTEGER_NTT_THRESHOLD);
+    REQUIRE(first * second == ((high * second) << split_bit_count) + low * second);
+}
+
+TEST_CASE("big_integer big_integer::square() const",
+          "Testing squaring of big_integer numbers and detection of identical operands in operator*") {
+    REQUIRE(big_integer{0}.square().is_zero());
+    REQUIRE(big_integer{-12}.square() == big_integer{144});
+    REQUIRE(big_integer{"-18446744073709551616"}.square() == big_integer{"340282366920938463463374607431768211456"});
+    REQUIRE(big_integer::nan.square().is_nan());
+
+    for (const size_t hexadecimal_digit_count : {1U, 16U, 300U, 1000U, 8000U, 16000U,
+                                                 16U * (BIG_INTEGER_NTT_THRESHOLD + 10U)}) {
+        const big_integer number{patterned_hexadecimal_number(hexadecimal_digit_count, 11U, 7U, 3U, true)};
+        const big_integer copy_of_number{number};
+        const big_integer square_of_number{number.square()};
+
+        REQUIRE(!square_of_number.is_negative_number());
+        REQUIRE(square_of_number == number * copy_of_number);
+        REQUIRE(number * number == square_of_number);
+
+        big_integer assigned_square{number};
+        assigned_square *= assigned_square;
+        REQUIRE(assigned_square == square_of_number);
+    }
+
+    const std::string all_ones(2000U, 'F');
+    REQUIRE(big_integer{"0x" + all_ones}.square().get_hexadecimal_number() ==
+            "0x" + std::string(1999U, 'F') + "E" + std::string(1999U, '0') + "1");
+}
+
+TEST_CASE("Division of long numbers",
+          "Testing operator/ and operator% sharing the long division of magnitudes") {
+    const big_integer one{1};
+    const big_integer divisor{"0x" + std::string(200U, 'F')};
+    const big_integer multiplier{"-0x8000000000000000" + std::string(300U, '0')};
+    const big_integer offset{"0x" + std::string(199U, 'F') + "E"};
+    const big_integer dividend{divisor * multiplier - offset};
+
+    REQUIRE(dividend / divisor == multiplier);
+    REQUIRE(dividend % divisor == -offset);
+    REQUIRE(dividend / -divisor == -multiplier);
+    REQUIRE(dividend % -divisor == -offset);
+    REQUIRE((-dividend) / divisor == -multiplier);
+    REQUIRE((-dividend) % divisor == offset);
+    REQUIRE((divisor * multiplier) % divisor == big_integer{0});
+    REQUIRE(offset / divisor == big_integer{0});
+    REQUIRE(offset % divisor == offset);
+    REQUIRE(divisor / divisor == one);
+
+    big_integer quotient{}, remainder{};
+    dividend.divide_two_big_integers(divisor, quotient, remainder);
+    REQUIRE(quotient * divisor + remainder == dividend);
+
+    big_integer number{dividend};
+    number.divide_two_big_integers(number, number, remainder);
+    REQUIRE(number == one);
+    REQUIRE(remainder.is_zero());
+}
+
+TEST_CASE("divmod(const big_integer&, const big_integer&)",
+          "Testing the combined computation of quotient and remainder") {
+    const big_integer dividend{"-123456789012345678901234567890123456789"};
+    const big_integer divisor{"9876543210987654321"};
+
+    const auto [quotient, remainder] = divmod(dividend, divisor);
+    REQUIRE(quotient == dividend / divisor);
+    REQUIRE(remainder == dividend % divisor);
+    REQUIRE(quotient == big_integer{"-12499999886093750001"});
+    REQUIRE(remainder == big_integer{"-5420524680542052468"});
+    REQUIRE(quotient * divisor + remainder == dividend);
+
+    big_integer in_place_quotient{}, in_place_remainder{};
+    divmod(dividend, -divisor, in_place_quotient, in_place_remainder);
+    REQUIRE(in_place_quotient == -quotient);
+    REQUIRE(in_place_remainder == remainder);
+
+    big_integer number{dividend};
+    divmod(number, divisor, number, in_place_remainder);
+    REQUIRE(number == quotient);
+    REQUIRE(in_place_remainder == remainder);
+
+    divmod(big_integer{0}, divisor, in_place_quotient, in_place_remainder);
+    REQUIRE(in_place_quotient.is_zero());
+    REQUIRE(in_place_remainder.is_zero());
+
+    const auto [nan_quotient, nan_remainder] = divmod(big_integer::nan, divisor);
+    REQUIRE(nan_quotient.is_nan());
+    REQUIRE(nan_remainder.is_nan());
+}
+
+TEST_CASE("Division of very long numbers",
+          "Testing Burnikel-Ziegler division of operands above BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD limbs") {
+    const big_integer one{1};
+
+    for (const size_t hexadecimal_digit_count : {16U * BIG_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD, 5000U, 20000U}) {
+        // the offset is one digit shorter than the divisor and thus less than it
+        const big_integer divisor{patterned_hexadecimal_number(hexadecimal_digit_count, 7U, 17U, 1U, false)};
+        const big_integer multiplier{patterned_hexadecimal_number(2U * hexadecimal_digit_count, 3U, 5U, 15U, true)};
+        const big_integer offset{patterned_hexadecimal_number(hexadecimal_digit_count - 1U, 13U, 11U, 2U, false)};
+        const big_integer dividend{divisor * multiplier - offset};
+
+        const auto [quotient, remainder] = divmod(dividend, divisor);
+        REQUIRE(quotient == multiplier);
+        REQUIRE(remainder == -offset);
+
+        const big_integer all_ones{"0x" + std::string(3U * hexadecimal_digit_count, 'F')};
+        const big_integer power_of_two{"0x1" + std::string(hexadecimal_digit_count, '0')};
+        REQUIRE(all_ones / power_of_two == big_integer{"0x" + std::string(2U * hexadecimal_digit_count, 'F')});
+        REQUIRE(all_ones % power_of_two == big_integer{"0x" + std::string(hexadecimal_digit_count, 'F')});
+        REQUIRE(all_ones / (power_of_two - one) ==
+                power_of_two * power_of_two + power_of_two + one);
+        REQUIRE((all_ones % (power_of_two - one)).is_zero());
+    }
+}
+
+TEST_CASE("reciprocal",
+          "Testing repeated division by an invariant divisor with a precomputed inverse") {
+    const reciprocal small_divisor{big_integer{"-1000000007"}};
+    REQUIRE(small_divisor.get_divisor() == big_integer{"-1000000007"});
+    REQUIRE(big_integer{"123456789012345678901234567890"} / small_divisor == big_integer{"-123456788148148161864"});
+    REQUIRE(big_integer{"123456789012345678901234567890"} % small_divisor == big_integer{"197434842"});
+    REQUIRE((big_integer{5} % small_divisor) == big_integer{5});
+
+    for (const size_t hexadecimal_digit_count : {16U * BIG_INTEGER_RECIPROCAL_THRESHOLD, 5000U}) {
+        const std::string divisor_digits{patterned_hexadecimal_number(hexadecimal_digit_count, 7U, 17U, 1U, false)};
+
+        const big_integer divisor{divisor_digits};
+        const reciprocal inverse_of_divisor{divisor};
+
+        big_integer dividend{divisor_digits + "0123456789ABCDEF" + std::string(hexadecimal_digit_count, 'F')};
+        for (size_t i{}; i < 8U; ++i) {
+            big_integer quotient{}, remainder{};
+            inverse_of_divisor.divmod(dividend, quotient, remainder);
+
+            const auto [expected_quotient, expected_remainder] = divmod(dividend, divisor);
+            REQUIRE(quotient == expected_quotient);
+            REQUIRE(remainder == expected_remainder);
+            REQUIRE(dividend / inverse_of_divisor == expected_quotient);
+            REQUIRE(dividend % inverse_of_divisor == expected_remainder);
+
+            dividend = -(dividend * big_integer{0xFEDCBA9876543210ULL} + big_integer{static_cast<int>(i)});
+        }
+
+        REQUIRE((divisor * divisor) % inverse_of_divisor == big_integer{0});
+        REQUIRE((divisor * divisor - big_integer{1}) % inverse_of_divisor == divisor - big_integer{1});
+    }
+
+    const reciprocal zero_divisor{big_integer{0}};
+    REQUIRE((big_integer{10} / zero_divisor).is_nan());
+    REQUIRE((big_integer::nan % small_divisor).is_nan());
+}
+
+TEST_CASE("barrett_context",
+          "Testing modular reduction, multiplication and addition by a fixed modulus without division") {
+    const barrett_context small_context{big_integer{"-1000000007"}};
+    REQUIRE(small_context.get_modulus() == big_integer{"1000000007"});
+    REQUIRE(small_context.reduce(big_integer{"123456789012345678901234567890"}) == big_integer{"197434842"});
+    REQUIRE(small_context.reduce(big_integer{"-123456789012345678901234567890"}) == big_integer{"802565165"});
+    REQUIRE(small_context.reduce(big_integer{"-2000000014"}) == big_integer{0});
+    REQUIRE(small_context.mul_mod(big_integer{"999999999"}, big_integer{"999999999"}) == big_integer{64});
+    REQUIRE(small_context.mul_mod(big_integer{-2}, big_integer{3}) == big_integer{"1000000001"});
+    REQUIRE(small_context.add_mod(big_integer{"999999999"}, big_integer{"999999999"}) == big_integer{"999999991"});
+    REQUIRE(small_context.add_mod(big_integer{-5}, big_integer{3}) == big_integer{"1000000005"});
+
+    const std::string modulus_digits{patterned_hexadecimal_number(1000U, 5U, 13U, 3U, false)};
+
+    const big_integer modulus{modulus_digits};
+    const barrett_context context{modulus};
+
+    big_integer lhs{modulus_digits + "FEDCBA9876543210"}, rhs{modulus - big_integer{12345}};
+    for (size_t i{}; i < 8U; ++i) {
+        const big_integer reduced_lhs{context.reduce(lhs)};
+        REQUIRE(reduced_lhs == ((lhs % modulus) + modulus) % modulus);
+        REQUIRE(context.mul_mod(reduced_lhs, rhs) == (reduced_lhs * rhs) % modulus);
+        REQUIRE(context.add_mod(reduced_lhs, rhs) == (reduced_lhs + rhs) % modulus);
+        REQUIRE(context.mul_mod(lhs, lhs) == (lhs * lhs) % modulus);
+
+        rhs = context.mul_mod(rhs, reduced_lhs);
+        lhs = -(lhs * lhs + big_integer{static_cast<int>(i)});
+    }
+
+    REQUIRE(barrett_context{big_integer{1}}.mul_mod(big_integer{7}, big_integer{9}) == big_integer{0});
+    REQUIRE(barrett_context{big_integer{0}}.reduce(big_integer{10}).is_nan());
+    REQUIRE(small_context.add_mod(big_integer::nan, big_integer{1}).is_nan());
+}
+
+TEST_CASE("montgomery_context",
+          "Testing Montgomery form conversions, multiplication and squaring by a fixed odd modulus") {
+    const montgomery_context small_context{big_integer{"1000000007"}};
+    const big_integer small_r{big_integer{1} << 64U};
+    const big_integer small_modulus{"1000000007"};
+    REQUIRE(small_context.get_modulus() == small_modulus);
+    REQUIRE(small_context.to_montgomery(big_integer{1}) == small_r % small_modulus);
+    REQUIRE(small_context.to_montgomery(big_integer{-1}) == small_modulus - small_r % small_modulus);
+    REQUIRE(small_context.from_montgomery(small_context.to_montgomery(big_integer{"123456789012345678901234567890"})) ==
+            big_integer{"197434842"});
+
+    const big_integer small_lhs{small_context.to_montgomery(big_integer{"999999999"})};
+    const big_integer small_rhs{small_context.to_montgomery(big_integer{-3})};
+    REQUIRE(small_context.from_montgomery(small_context.mul(small_lhs, small_rhs)) == big_integer{24});
+    REQUIRE(small_context.from_montgomery(small_context.square(small_lhs)) == big_integer{64});
+
+    for (const size_t hexadecimal_digit_count : {200U, 16U * BIG_INTEGER_MONTGOMERY_REDC_THRESHOLD + 3U}) {
+        std::string modulus_digits{patterned_hexadecimal_number(hexadecimal_digit_count, 11U, 7U, 5U, false)};
+        modulus_digits.back() = 'F';
+
+        const big_integer modulus{modulus_digits};
+        const montgomery_context context{modulus};
+        const big_integer r{big_integer{1} << (64U * modulus.get_limbs().size())};
+
+        big_integer lhs{modulus_digits + "FEDCBA9876543210"}, rhs{modulus - big_integer{12345}};
+        for (size_t i{}; i < 6U; ++i) {
+            const big_integer lhs_form{context.to_montgomery(lhs)}, rhs_form{context.to_montgomery(rhs)};
+            REQUIRE(lhs_form == ((lhs % modulus) + modulus) * r % modulus);
+            REQUIRE(context.from_montgomery(lhs_form) == ((lhs % modulus) + modulus) % modulus);
+            REQUIRE(context.from_montgomery(context.mul(lhs_form, rhs_form)) ==
+                    ((lhs * rhs) % modulus + modulus) % modulus);
+            REQUIRE(context.from_montgomery(context.square(lhs_form)) == (lhs * lhs) % modulus);
+            REQUIRE(context.mul(lhs_form, rhs_form) * r % modulus == lhs_form * rhs_form % modulus);
+
+            rhs = context.from_montgomery(context.mul(lhs_form, rhs_form));
+            lhs = -(lhs * big_integer{0xFEDCBA9876543210ULL} + big_integer{static_cast<int>(i)});
+        }
+    }
+
+    REQUIRE(montgomery_context{big_integer{1}}.mul(big_integer{7}, big_integer{9}) == big_integer{0});
+    REQUIRE(montgomery_context{big_integer{10}}.to_montgomery(big_integer{3}).is_nan());
+    REQUIRE(montgomery_context{big_integer{0}}.square(big_integer{3}).is_nan());
+    REQUIRE(small_context.mul(big_integer::nan, big_integer{1}).is_nan());
+}
+
+TEST_CASE("pow_mod(const big_integer&, const big_integer&, const big_integer&)",
+          "Testing modular exponentiation with Montgomery and Barrett reduction and its constant-time variant") {
+    REQUIRE(pow_mod(big_integer{4}, big_integer{13}, big_integer{497}) == big_integer{445});
+    REQUIRE(pow_mod(big_integer{2}, big_integer{10}, big_integer{1000}) == big_integer{24});
+    REQUIRE(pow_mod(big_integer{-2}, big_integer{3}, big_integer{-7}) == big_integer{6});
+    REQUIRE(pow_mod(big_integer{5}, big_integer{0}, big_integer{7}) == big_integer{1});
+    REQUIRE(pow_mod(big_integer{5}, big_integer{0}, big_integer{1}) == big_integer{0});
+    REQUIRE(pow_mod(big_integer{0}, big_integer{0}, big_integer{8}) == big_integer{1});
+    REQUIRE(pow_mod(big_integer{123456789}, big_integer{987654321}, big_integer{"1000000000000000000000000000000"}) ==
+            big_integer{"909077141664922883132974933589"});
+    REQUIRE(pow_mod_constant_time(big_integer{4}, big_integer{13}, big_integer{497}) == big_integer{445});
+
+    // Fermat's little theorem for the Mersenne primes 2^521 - 1 and 2^607 - 1
+    for (const size_t exponent : {521U, 607U}) {
+        const big_integer prime{(big_integer{1} << exponent) - big_integer{1}};
+        const big_integer base{"0x123456789ABCDEF0FEDCBA9876543210"};
+        REQUIRE(pow_mod(base, prime - big_integer{1}, prime) == big_integer{1});
+        REQUIRE(pow_mod_constant_time(base, prime, prime) == base);
+        REQUIRE(pow_mod(prime - base, prime, prime) == prime - base);
+    }
+
+    const std::string modulus_digits{patterned_hexadecimal_number(600U, 3U, 11U, 7U, false)};
+
+    const big_integer odd_modulus{modulus_digits + "1"}, even_modulus{modulus_digits + "4"};
+    const big_integer base{modulus_digits + "FEDCBA9876543210"}, exponent{modulus_digits.substr(0, 300U)};
+    const big_integer odd_result{pow_mod(base, exponent, odd_modulus)};
+    REQUIRE(odd_result == barrett_context{odd_modulus}.pow(base, exponent));
+    REQUIRE(odd_result == pow_mod_constant_time(base, exponent, odd_modulus));
+    REQUIRE(pow_mod(base, exponent + big_integer{1}, odd_modulus) == base * odd_result % odd_modulus);
+    const big_integer even_result{pow_mod(base, exponent, even_modulus)};
+    REQUIRE(pow_mod(base, exponent + big_integer{1}, even_modulus) == base * even_result % even_modulus);
+    REQUIRE(pow_mod(-base, exponent + exponent, even_modulus) == even_result * even_result % even_modulus);
+
+    REQUIRE(pow_mod(big_integer{2}, big_integer{-1}, big_integer{7}).is_nan());
+    REQUIRE(pow_mod(big_integer{2}, big_integer{3}, big_integer{0}).is_nan());
+    REQUIRE(pow_mod(big_integer::nan, big_integer{3}, big_integer{7}).is_nan());
+    REQUIRE(pow_mod_constant_time(big_integer{2}, big_integer{3}, big_integer{8}).is_nan());
+}
+
+TEST_CASE("pow(const big_integer&, const std::uint64_t)",
+          "Testing integer powers by repeated squaring, shifts for powers of two and cached powers of ten") {
+    REQUIRE(pow(big_integer{-3}, 5U) == big_integer{-243});
+    REQUIRE(pow(big_integer{-3}, 4U) == big_integer{81});
+    REQUIRE(pow(big_integer{0}, 0U) == big_integer{1});
+    REQUIRE(pow(big_integer{0}, 7U) == big_integer{0});
+    REQUIRE(pow(big_integer{-1}, 1000001U) == big_integer{-1});
+    REQUIRE(pow(big_integer{2}, 100U) == big_integer{"1267650600228229401496703205376"});
+    REQUIRE(pow(big_integer{-8}, 43U) == -(big_integer{1} << 129U));
+    REQUIRE(pow(big_integer{10}, 0U) == big_integer{1});
+    REQUIRE(pow(big_integer{10}, 19U) == big_integer{"10000000000000000000"});
+    REQUIRE(pow(big_integer{-10}, 45U) == big_integer{"-1" + std::string(45U, '0')});
+    REQUIRE(pow(big_integer{10}, 2000U).get_decimal_number() == "1" + std::string(2000U, '0'));
+    REQUIRE(big_integer{"1000000000000"}.pow(77U) == big_integer{"1" + std::string(924U, '0')});
+    REQUIRE(pow(big_integer::nan, 2U).is_nan());
+
+    big_integer expected{1};
+    const big_integer twelve{12};
+    for (size_t i{}; i < 300U; ++i)
+        expected *= twelve;
+    REQUIRE(pow(twelve, 300U) == expected);
+    REQUIRE(expected.get_decimal_number().substr(284U) == "5108944583217651567620935100716470501376");
+
+    const big_integer base{"0x123456789ABCDEF0123456789ABCDEF0000"};
+    expected = big_integer{1};
+    for (size_t i{}; i < 45U; ++i)
+        expected *= base;
+    REQUIRE(pow(base, 45U) == expected);
+    REQUIRE(pow(-base, 45U) == -expected);
+}
+
+TEST_CASE("isqrt, isqrt_rem and iroot",
+          "Testing integer square roots and k-th roots by Newton iteration") {
+    REQUIRE(isqrt(big_integer{0}) == big_integer{0});
+    REQUIRE(isqrt(big_integer{1}) == big_integer{1});
+    REQUIRE(isqrt(big_integer{3}) == big_integer{1});
+    REQUIRE(isqrt(big_integer{4}) == big_integer{2});
+    REQUIRE(isqrt(big_integer{"18446744073709551615"}) == big_integer{"4294967295"});
+    REQUIRE(isqrt(big_integer{"18446744073709551616"}) == big_integer{"4294967296"});
+    REQUIRE(isqrt(pow(big_integer{10}, 100U)) == pow(big_integer{10}, 50U));
+    REQUIRE(isqrt(pow(big_integer{10}, 100U) - big_integer{1}) == pow(big_integer{10}, 50U) - big_integer{1});
+
+    const big_integer number{[] {
+        std::string digits{};
+        for (size_t i{}; i < 50U; ++i)
+            digits += "123456789";
+        return big_integer{digits};
+    }()};
+    const auto [root, remainder] = isqrt_rem(number);
+    REQUIRE(root.get_decimal_number().size() == 225U);
+    REQUIRE(root * root + remainder == number);
+    REQUIRE(remainder <= root + root);
+
+    const big_integer long_number{patterned_hexadecimal_number(20000U, 13U, 5U, 1U, false)};
+    const big_integer long_root{isqrt(long_number)};
+    REQUIRE(long_root * long_root <= long_number);
+    REQUIRE((long_root + big_integer{1}) * (long_root + big_integer{1}) > long_number);
+    REQUIRE(isqrt(long_root * long_root) == long_root);
+
+    REQUIRE(iroot(big_integer{27}, 3U) == big_integer{3});
+    REQUIRE(iroot(big_integer{26}, 3U) == big_integer{2});
+    REQUIRE(iroot(big_integer{-28}, 3U) == big_integer{-3});
+    REQUIRE(iroot(number, 1U) == number);
+    REQUIRE(iroot(number, 1000U) == big_integer{2});
+    REQUIRE(iroot(number, 2000U) == big_integer{1});
+    REQUIRE(iroot(pow(number, 7U), 7U) == number);
+    REQUIRE(iroot(pow(number, 7U) - big_integer{1}, 7U) == number - big_integer{1});
+    REQUIRE(iroot(big_integer{1} << 130U, 65U) == big_integer{4});
+
+    // degrees beyond the bit length, far too many to step through one multiplication at a time
+    REQUIRE(iroot(big_integer{5}, 1'000'000'000'000U) == big_integer{1});
+    REQUIRE(iroot(big_integer{-5}, 1'000'000'000'001U) == big_integer{-1});
+    REQUIRE(iroot(big_integer{1}, std::numeric_limits<std::uint64_t>::max()) == big_integer{1});
+    REQUIRE(iroot(big_integer{0}, std::numeric_limits<std::uint64_t>::max()).is_zero());
+    REQUIRE(iroot(number, std::numeric_limits<std::uint64_t>::max()) == big_integer{1});
+    REQUIRE(iroot(big_integer{1U << 20U}, 20U) == big_integer{2});
+    REQUIRE(iroot(big_integer{(1U << 20U) - 1U}, 20U) == big_integer{1});
+
+    REQUIRE(isqrt(big_integer{-4}).is_nan());
+    REQUIRE(isqrt_rem(big_integer::nan).second.is_nan());
+    REQUIRE(iroot(big_integer{-4}, 2U).is_nan());
+    REQUIRE(iroot(big_integer{4}, 0U).is_nan());
+}
+
+TEST_CASE("is_perfect_square and is_perfect_power",
+          "Testing perfect square and perfect power detection with residue filters") {
+    for (const int number : {0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 144, 1024})
+        REQUIRE(is_perfect_square(big_integer{number}));
+    for (const int number : {2, 3, 5, 8, 10, 15, 24, 99, 1023, -4, -1})
+        REQUIRE_FALSE(is_perfect_square(big_integer{number}));
+
+    for (const int number : {0, 1, -1, 4, 8, -8, 9, 16, 27, -27, 32, -32, 36, 64, 81, 125, 128, 243, 1000, -1000})
+        REQUIRE(is_perfect_power(big_integer{number}));
+    for (const int number : {2, 3, 5, 6, 10, 12, 18, 24, 63, 65, 99, 1001, -4, -16, -36})
+        REQUIRE_FALSE(is_perfect_power(big_integer{number}));
+
+    const big_integer base{"0x123456789ABCDEF0123456789ABCDEF1"};
+    const big_integer square{base * base};
+    REQUIRE(is_perfect_square(square));
+    REQUIRE(is_perfect_square(square << 128U));
+    REQUIRE_FALSE(is_perfect_square(square + big_integer{1}));
+    REQUIRE_FALSE(is_perfect_square(square - big_integer{1}));
+    REQUIRE_FALSE(is_perfect_square(square << 127U));
+
+    REQUIRE(is_perfect_power(square));
+    REQUIRE(is_perfect_power(pow(base, 3U)));
+    REQUIRE(is_perfect_power(-pow(base, 3U)));
+    REQUIRE_FALSE(is_perfect_power(-square));
+    REQUIRE(is_perfect_power(pow(big_integer{12345}, 37U)));
+    REQUIRE(is_perfect_power(pow(big_integer{-6}, 101U)));
+    REQUIRE(is_perfect_power(big_integer{1} << 1009U));
+    REQUIRE(is_perfect_power(pow(base, 5U) << 320U));
+    REQUIRE_FALSE(is_perfect_power(pow(base, 5U) << 321U));
+    REQUIRE_FALSE(is_perfect_power(pow(base, 5U) + big_integer{1}));
+    REQUIRE_FALSE(is_perfect_power(pow(big_integer{12345}, 37U) - big_integer{1}));
+
+    // the residue tables cover every degree below 64
+    for (const std::uint64_t degree : {7U, 31U, 53U, 61U}) {
+        REQUIRE(is_perfect_power(pow(big_integer{1000003}, degree)));
+        REQUIRE(is_perfect_power(-pow(big_integer{99991}, degree)));
+        REQUIRE_FALSE(is_perfect_power(pow(big_integer{1000003}, degree) + big_integer{2}));
+    }
+    REQUIRE_FALSE(is_perfect_power(big_integer::nan));
+}
+
+TEST_CASE("gcd, lcm and extended_gcd", "Testing binary, Lehmer and half-GCD reduction with Bezout coefficients") {
+    REQUIRE(gcd(big_integer{12}, big_integer{18}) == big_integer{6});
+    REQUIRE(gcd(big_integer{-12}, big_integer{18}) == big_integer{6});
+    REQUIRE(gcd(big_integer{0}, big_integer{-7}) == big_integer{7});
+    REQUIRE(gcd(big_integer{0}, big_integer{0}) == big_integer{0});
+    REQUIRE(gcd(big_integer{17}, big_integer{5}) == big_integer{1});
+    REQUIRE(lcm(big_integer{4}, big_integer{-6}) == big_integer{12});
+    REQUIRE(lcm(big_integer{0}, big_integer{6}) == big_integer{0});
+    REQUIRE(gcd(big_integer::nan, big_integer{6}).is_nan());
+    REQUIRE(lcm(big_integer{6}, big_integer::nan).is_nan());
+
+    // gcd(F(m), F(n)) = F(gcd(m, n)) for Fibonacci numbers, whose Euclidean quotients are all 1
+    std::vector<big_integer> fibonacci{big_integer{0}, big_integer{1}};
+    for (size_t i{2U}; i <= 20000U; ++i)
+        fibonacci.emplace_back(fibonacci[i - 1] + fibonacci[i - 2]);
+
+    REQUIRE(gcd(fibonacci[300], fibonacci[200]) == fibonacci[100]);
+    REQUIRE(gcd(fibonacci[3001], fibonacci[2000]) == big_integer{1});
+    REQUIRE(gcd(fibonacci[20000], fibonacci[15000]) == fibonacci[5000]);
+    REQUIRE(lcm(fibonacci[20000], fibonacci[15000]) == fibonacci[20000] / fibonacci[5000] * fibonacci[15000]);
+
+    const big_integer factor{"0x123456789ABCDEF0123456789ABCDEF1"};
+    const big_integer lhs{(fibonacci[19999] << 7U) * factor}, rhs{-fibonacci[18000] * factor};
+    REQUIRE(gcd(lhs, rhs) == factor << 6U);
+
+    for (const auto &operands : {std::make_pair(big_integer{240}, big_integer{46}),
+                                 std::make_pair(big_integer{-240}, big_integer{46}),
+                                 std::make_pair(big_integer{7}, big_integer{0}),
+                                 std::make_pair(big_integer{0}, big_integer{-7}),
+                                 std::make_pair(fibonacci[1000], fibonacci[999]),
+                                 std::make_pair(lhs, rhs),
+                                 std::make_pair(rhs, fibonacci[20000] * factor)}) {
+        const auto [divisor, s, t] = extended_gcd(operands.first, operands.second);
+        REQUIRE(divisor == gcd(operands.first, operands.second));
+        REQUIRE(operands.first * s + operands.second * t == divisor);
+        REQUIRE(s.abs() <= operands.second.abs() / divisor + big_integer{1});
+        REQUIRE(t.abs() <= operands.first.abs() / divisor + big_integer{1});
+    }
+
+    const auto [divisor, s, t] = extended_gcd(big_integer{0}, big_integer{0});
+    REQUIRE(divisor.is_zero());
+    REQUIRE(s.is_zero());
+    REQUIRE(t.is_zero());
+}
+
+TEST_CASE("inverse_mod and crt", "Testing modular inverses and Chinese remaindering by a product tree") {
+    REQUIRE(inverse_mod(big_integer{3}, big_integer{11}) == big_integer{4});
+    REQUIRE(inverse_mod(big_integer{-3}, big_integer{11}) == big_integer{7});
+    REQUIRE(inverse_mod(big_integer{3}, big_integer{-11}) == big_integer{4});
+    REQUIRE(inverse_mod(big_integer{5}, big_integer{1}) == big_integer{0});
+    REQUIRE(inverse_mod(big_integer{"12345678901234567890123"}, (big_integer{1} << 127U) - big_integer{1}) ==
+            big_integer{"89721932055196168212235709152917502039"});
+    REQUIRE(inverse_mod(big_integer{6}, big_integer{9}).is_nan());
+    REQUIRE(inverse_mod(big_integer{0}, big_integer{7}).is_nan());
+    REQUIRE(inverse_mod(big_integer::nan, big_integer{7}).is_nan());
+
+    REQUIRE(crt({big_integer{2}, big_integer{3}, big_integer{2}, big_integer{-1}},
+                {big_integer{3}, big_integer{5}, big_integer{7}, big_integer{-11}}) == big_integer{758});
+    REQUIRE(crt({}, {}) == big_integer{0});
+    REQUIRE(crt({big_integer{1}, big_integer{2}}, {big_integer{4}, big_integer{6}}).is_nan());
+    REQUIRE(crt({big_integer{1}}, {big_integer{4}, big_integer{5}}).is_nan());
+
+    const std::vector<big_integer> moduli{(big_integer{1} << 61U) - big_integer{1},
+                                          (big_integer{1} << 89U) - big_integer{1},
+                                          (big_integer{1} << 107U) - big_integer{1},
+                                          (big_integer{1} << 127U) - big_integer{1},
+                                          big_integer{"1000000000000000000000000000057"}};
+    const crt_context context{moduli};
+    REQUIRE(context.get_modulus() == moduli[0] * moduli[1] * moduli[2] * moduli[3] * moduli[4]);
+
+    for (const big_integer &number : {pow(big_integer{"123456789123456789123456789"}, 3U), big_integer{0},
+                                      context.get_modulus() - big_integer{1}}) {
+        std::vector<big_integer> residues{};
+        for (const big_integer &modulus : moduli)
+            residues.emplace_back(number % modulus);
+        REQUIRE(context.reconstruct(residues) == number);
+        REQUIRE(crt(residues, moduli) == number);
+    }
+
+    REQUIRE(context.reconstruct({big_integer{1}, big_integer::nan, big_integer{1}, big_integer{1}, big_integer{1}})
+                    .is_nan());
+}
+
+TEST_CASE("is_probable_prime(const big_integer&, const size_t)",
+          "Testing trial division, deterministic Miller-Rabin below 2^64 and Baillie-PSW above") {
+    for (const int number : {2, 3, 5, 7, 11, 13, 97, 101, 997, 7919})
+        REQUIRE(is_probable_prime(big_integer{number}));
+    for (const int number : {-7, 0, 1, 4, 9, 15, 91, 561, 1001, 1105, 5459, 5777, 10877})
+        REQUIRE_FALSE(is_probable_prime(big_integer{number}));
+
+    // primes near 2^32 and 2^64, Fermat's F5 = 641 * 6700417 and strong pseudoprimes to the first prime bases
+    REQUIRE(is_probable_prime(big_integer{"4294967291"}));
+    REQUIRE(is_probable_prime(big_integer{"18446744073709551557"}));
+    REQUIRE(is_probable_prime(big_integer{"18446744073709551629"}));
+    REQUIRE_FALSE(is_probable_prime(big_integer{"4294967297"}));
+    REQUIRE_FALSE(is_probable_prime(big_integer{"3215031751"}));
+    REQUIRE_FALSE(is_probable_prime(big_integer{"3825123056546413051"}));
+    REQUIRE_FALSE(is_probable_prime(big_integer{"318665857834031151167461"}));
+    REQUIRE_FALSE(is_probable_prime(big_integer{"3317044064679887385961981"}));
+
+    const big_integer googol{pow(big_integer{10}, 100U)};
+    REQUIRE(is_probable_prime(googol + big_integer{267}));
+    REQUIRE(is_probable_prime(googol + big_integer{267}, 10U));
+    REQUIRE_FALSE(is_probable_prime(googol + big_integer{269}));
+
+    for (const size_t exponent : {61U, 89U, 107U, 127U, 521U})
+        REQUIRE(is_probable_prime((big_integer{1} << exponent) - big_integer{1}));
+    REQUIRE_FALSE(is_probable_prime((big_integer{1} << 523U) - big_integer{1}));
+
+    const big_integer prime{(big_integer{1} << 127U) - big_integer{1}};
+    REQUIRE_FALSE(is_probable_prime(prime * prime));
+    REQUIRE_FALSE(is_probable_prime(prime * ((big_integer{1} << 89U) - big_integer{1})));
+    REQUIRE_FALSE(is_probable_prime(-prime));
+    REQUIRE_FALSE(is_probable_prime(big_integer::nan));
+}
+
+TEST_CASE("next_prime and prev_prime", "Testing single-limb stepping and sieved windows in both directions") {
+    REQUIRE(next_prime(big_integer{-5}) == big_integer{2});
+    REQUIRE(next_prime(big_integer{2}) == big_integer{3});
+    REQUIRE(next_prime(big_integer{3}) == big_integer{5});
+    REQUIRE(next_prime(big_integer{7919}) == big_integer{7927});
+    REQUIRE(prev_prime(big_integer{3}) == big_integer{2});
+    REQUIRE(prev_prime(big_integer{4}) == big_integer{3});
+    REQUIRE(prev_prime(big_integer{7927}) == big_integer{7919});
+    REQUIRE(prev_prime(big_integer{2}).is_nan());
+    REQUIRE(prev_prime(big_integer{-11}).is_nan());
+    REQUIRE(next_prime(big_integer::nan).is_nan());
+    REQUIRE(prev_prime(big_integer::nan).is_nan());
+
+    // across 2^64, between its largest prime 2^64 - 59 and the smallest prime above 2^64 + 13
+    const big_integer below{"18446744073709551557"}, above{"18446744073709551629"};
+    REQUIRE(next_prime(below) == above);
+    REQUIRE(next_prime(above - big_integer{1}) == above);
+    REQUIRE(prev_prime(above) == below);
+    REQUIRE(prev_prime(below) == below - big_integer{24});
+
+    const big_integer googol{pow(big_integer{10}, 100U)};
+    REQUIRE(next_prime(googol) == googol + big_integer{267});
+    REQUIRE(prev_prime(googol) == googol - big_integer{797});
+    REQUIRE(next_prime(googol + big_integer{267}) > googol + big_integer{267});
+    REQUIRE(prev_prime(googol + big_integer{268}) == googol + big_integer{267});
+
+    const big_integer power{big_integer{1} << 128U};
+    REQUIRE(next_prime(power) == power + big_integer{51});
+    REQUIRE(prev_prime(power) == power - big_integer{159});
+    REQUIRE(next_prime((big_integer{1} << 127U) - big_integer{1}) == (big_integer{1} << 127U) + big_integer{29});
+}
+
+TEST_CASE("parallel next_prime and random_prime", "Testing prime searches split among worker threads") {
+    const big_integer googol{pow(big_integer{10}, 100U)};
+    for (const size_t thread_count : {0U, 2U, 3U, 8U}) {
+        REQUIRE(next_prime(googol, thread_count) == googol + big_integer{267});
+        REQUIRE(prev_prime(googol, thread_count) == googol - big_integer{797});
+        REQUIRE(next_prime(big_integer{"18446744073709551557"}, thread_count) == big_integer{"18446744073709551629"});
+    }
+
+    std::mt19937_64 generator{2024U};
+    for (const size_t bit_count : {2U, 17U, 64U, 65U, 256U}) {
+        const big_integer prime{random_prime(bit_count, generator, 4U)};
+        REQUIRE(prime.get_limbs().size() == (bit_count + 63U) / 64U);
+        REQUIRE((prime >> (bit_count - 1U)) == big_integer{1});
+        REQUIRE(is_probable_prime(prime, 5U));
+    }
+
+    REQUIRE(random_prime(1U, generator).is_nan());
+}
+
+TEST_CASE("factorial, binomial, double_factorial and primorial", "Testing prime swing and balanced product trees") {
+    big_integer product{1};
+    for (std::uint64_t n{}; n <= 300U; ++n) {
+        if (n > 1U)
+            product *= big_integer{n};
+        REQUIRE(factorial(n) == product);
+    }
+    REQUIRE(factorial(25U) == big_integer{"15511210043330985984000000"});
+
+    const big_integer factorial_1000{factorial(1000U)};
+    REQUIRE(factorial(1001U) == factorial_1000 * big_integer{1001});
+    REQUIRE(double_factorial(1001U) * double_factorial(1000U) == factorial(1001U));
+    REQUIRE(double_factorial(21U) == big_integer{13749310575ULL});
+    REQUIRE(double_factorial(20U) == big_integer{3715891200ULL});
+    REQUIRE(double_factorial(0U) == big_integer{1});
+    REQUIRE(double_factorial(1U) == big_integer{1});
+
+    REQUIRE(binomial(100U, 50U) == big_integer{"100891344545564193334812497256"});
+    REQUIRE(binomial(1000U, 300U) == factorial_1000 / (factorial(300U) * factorial(700U)));
+    REQUIRE(binomial(1000U, 3U) == big_integer{166167000});
+    REQUIRE(binomial((1ULL << 40U) + 7U, 3U) == big_integer{"221537999301112756276164672194871331"});
+    REQUIRE(binomial(7U, 0U) == big_integer{1});
+    REQUIRE(binomial(7U, 7U) == big_integer{1});
+    REQUIRE(binomial(7U, 8U).is_zero());
+
+    REQUIRE(primorial(100U) == big_integer{"2305567963945518424753102147331756070"});
+    REQUIRE(primorial(1U) == big_integer{1});
+    REQUIRE(primorial(2U) == big_integer{2});
+}
+
+TEST_CASE("product of a range", "Testing balanced product trees, sequential and on several threads") {
+    std::vector<big_integer> numbers{};
+    big_integer expected{1};
+    for (size_t i{}; i < 500U; ++i) {
+        big_integer number{(big_integer{1} << (64U * (i % 7U) + i)) - big_integer{static_cast<int>(i) + 1}};
+        if (i % 3U == 0U)
+            number = -number;
+        expected *= number;
+        numbers.emplace_back(std::move(number));
+    }
+
+    REQUIRE(product(numbers) == expected);
+    REQUIRE(product(numbers.cbegin(), numbers.cend()) == expected);
+    for (const size_t thread_count : {0U, 2U, 5U})
+        REQUIRE(product(numbers, thread_count) == expected);
+    REQUIRE(product(numbers.cbegin() + 1, numbers.cbegin() + 4) == numbers[1] * numbers[2] * numbers[3]);
+
+    REQUIRE(product(std::vector<big_integer>{}) == big_integer{1});
+    REQUIRE(product(std::vector<big_integer>{big_integer{-7}}) == big_integer{-7});
+    REQUIRE(product(std::vector<big_integer>{big_integer{2}, big_integer{}, big_integer{3}}).is_zero());
+    REQUIRE(product(std::vector<big_integer>{big_integer{2}, big_integer::nan, big_integer{3}}, 2U).is_nan());
+}